@@ -2,7 +2,8 @@ from conans import ConanFile
 
 class SupercellWxConan(ConanFile):
     settings   = ("os", "compiler", "build_type", "arch")
-    requires   = ("boost/1.81.0",
+    requires   = ("benchmark/1.8.0",
+                  "boost/1.81.0",
                   "cpr/1.9.3",
                   "freetype/2.12.1",
                   "geographiclib/1.52",
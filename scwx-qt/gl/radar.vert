@@ -6,6 +6,14 @@
 #define PI            3.1415926535897932384626433f
 #define RAD2DEG       57.295779513082320876798156332941f
 
+#define MAX_DATA_MOMENT_GATES 1840u
+#define VERTICES_PER_GATE     6
+
+#define GATE_BITS   11u
+#define RADIAL_BITS 10u
+#define GATE_MASK   0x7ffu
+#define RADIAL_MASK 0x3ffu
+
 layout (location = 0) in vec2 aLatLong;
 layout (location = 1) in uint aDataMoment;
 layout (location = 2) in uint aCfpMoment;
@@ -13,6 +21,15 @@ layout (location = 2) in uint aCfpMoment;
 uniform mat4 uMVPMatrix;
 uniform vec2 uMapScreenCoord;
 
+// Indexed mesh
+uniform bool           uMeshEnabled;
+uniform uint           uMeshRadials;
+uniform vec2           uMeshCenter;
+uniform samplerBuffer  uMeshCoordinates;
+uniform usamplerBuffer uMeshGates;
+uniform usamplerBuffer uMeshDataMoments;
+uniform usamplerBuffer uMeshCfpMoments;
+
 flat out uint dataMoment;
 flat out uint cfpMoment;
 
@@ -25,13 +42,69 @@ vec2 latLngToScreenCoordinate(in vec2 latLng)
    return p;
 }
 
+vec2 meshCoordinate(in uint radial, in uint gate)
+{
+   return texelFetch(uMeshCoordinates, int(radial * MAX_DATA_MOMENT_GATES + gate)).rg;
+}
+
+vec2 meshLatLong(in int gateIndex, in int corner)
+{
+   uint packedGate = texelFetch(uMeshGates, gateIndex).r;
+   uint gate       = packedGate & GATE_MASK;
+   uint radial1    = (packedGate >> GATE_BITS) & RADIAL_MASK;
+   uint radial2    = (radial1 + 1u) % uMeshRadials;
+   uint gateSize   = packedGate >> (GATE_BITS + RADIAL_BITS);
+
+   if (gate > 0u)
+   {
+      // Two triangles, with corners ordered 1, 2, 3, 3, 4, 2
+      uint bin1 = gate - 1u;
+      uint bin2 = bin1 + gateSize;
+
+      bool outerRadial = (corner == 2 || corner == 3 || corner == 4);
+      bool outerBin    = (corner == 1 || corner == 4 || corner == 5);
+
+      return meshCoordinate(outerRadial ? radial2 : radial1,
+                            outerBin ? bin2 : bin1);
+   }
+
+   // A single triangle from the radar, the remaining corners are degenerate
+   if (corner == 1)
+   {
+      return meshCoordinate(radial1, 0u);
+   }
+   else if (corner == 2)
+   {
+      return meshCoordinate(radial2, 0u);
+   }
+
+   return uMeshCenter;
+}
+
 void main()
 {
-   // Pass the coded data moment to the fragment shader
-   dataMoment = aDataMoment;
-   cfpMoment  = aCfpMoment;
+   vec2 latLong;
+
+   if (uMeshEnabled)
+   {
+      int gateIndex = gl_VertexID / VERTICES_PER_GATE;
+      int corner    = gl_VertexID % VERTICES_PER_GATE;
+
+      latLong    = meshLatLong(gateIndex, corner);
+      dataMoment = texelFetch(uMeshDataMoments, gateIndex).r;
+      cfpMoment  = (gateIndex < textureSize(uMeshCfpMoments)) ?
+                      texelFetch(uMeshCfpMoments, gateIndex).r :
+                      0u;
+   }
+   else
+   {
+      // Pass the coded data moment to the fragment shader
+      latLong    = aLatLong;
+      dataMoment = aDataMoment;
+      cfpMoment  = aCfpMoment;
+   }
 
-   vec2 p = latLngToScreenCoordinate(aLatLong) - uMapScreenCoord;
+   vec2 p = latLngToScreenCoordinate(latLong) - uMapScreenCoord;
 
    // Transform the position to screen coordinates
    gl_Position = uMVPMatrix * vec4(p, 0.0f, 1.0f);
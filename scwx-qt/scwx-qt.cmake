@@ -188,10 +188,13 @@ set(HDR_UTIL source/scwx/qt/util/color.hpp
              source/scwx/qt/util/font_buffer.hpp
              source/scwx/qt/util/geographic_lib.hpp
              source/scwx/qt/util/json.hpp
+             source/scwx/qt/util/polar_coordinate_cache.hpp
              source/scwx/qt/util/streams.hpp
              source/scwx/qt/util/texture_atlas.hpp
              source/scwx/qt/util/q_file_buffer.hpp
              source/scwx/qt/util/q_file_input_stream.hpp
+             source/scwx/qt/util/radial_projector.hpp
+             source/scwx/qt/util/raster_coordinate_cache.hpp
              source/scwx/qt/util/time.hpp)
 set(SRC_UTIL source/scwx/qt/util/color.cpp
              source/scwx/qt/util/file.cpp
@@ -199,22 +202,29 @@ set(SRC_UTIL source/scwx/qt/util/color.cpp
              source/scwx/qt/util/font_buffer.cpp
              source/scwx/qt/util/geographic_lib.cpp
              source/scwx/qt/util/json.cpp
+             source/scwx/qt/util/polar_coordinate_cache.cpp
              source/scwx/qt/util/texture_atlas.cpp
              source/scwx/qt/util/q_file_buffer.cpp
              source/scwx/qt/util/q_file_input_stream.cpp
+             source/scwx/qt/util/radial_projector.cpp
+             source/scwx/qt/util/raster_coordinate_cache.cpp
              source/scwx/qt/util/time.cpp)
 set(HDR_VIEW source/scwx/qt/view/level2_product_view.hpp
              source/scwx/qt/view/level3_product_view.hpp
              source/scwx/qt/view/level3_radial_view.hpp
              source/scwx/qt/view/level3_raster_view.hpp
+             source/scwx/qt/view/radar_mesh.hpp
              source/scwx/qt/view/radar_product_view.hpp
-             source/scwx/qt/view/radar_product_view_factory.hpp)
+             source/scwx/qt/view/radar_product_view_factory.hpp
+             source/scwx/qt/view/radial_sweep.hpp)
 set(SRC_VIEW source/scwx/qt/view/level2_product_view.cpp
              source/scwx/qt/view/level3_product_view.cpp
              source/scwx/qt/view/level3_radial_view.cpp
              source/scwx/qt/view/level3_raster_view.cpp
+             source/scwx/qt/view/radar_mesh.cpp
              source/scwx/qt/view/radar_product_view.cpp
-             source/scwx/qt/view/radar_product_view_factory.cpp)
+             source/scwx/qt/view/radar_product_view_factory.cpp
+             source/scwx/qt/view/radial_sweep.cpp)
 
 set(RESOURCE_FILES scwx-qt.qrc)
 
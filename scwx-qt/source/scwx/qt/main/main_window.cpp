@@ -343,7 +343,8 @@ void MainWindow::on_actionOpenNexrad_triggered()
 
    QFileDialog* dialog = new QFileDialog(this);
 
-   dialog->setFileMode(QFileDialog::ExistingFile);
+   // Multiple files are loaded as the real-time chunks of a level 2 volume
+   dialog->setFileMode(QFileDialog::ExistingFiles);
    dialog->setNameFilter(tr(nexradFilter.c_str()));
    dialog->setAttribute(Qt::WA_DeleteOnClose);
 
@@ -359,11 +360,19 @@ void MainWindow::on_actionOpenNexrad_triggered()
 
    connect(
       dialog,
-      &QFileDialog::fileSelected,
+      &QFileDialog::filesSelected,
       this,
-      [=, this](const QString& file)
+      [=, this](QStringList files)
       {
-         logger_->info("Selected: {}", file.toStdString());
+         if (files.isEmpty())
+         {
+            return;
+         }
+
+         for (auto& file : files)
+         {
+            logger_->info("Selected: {}", file.toStdString());
+         }
 
          std::shared_ptr<request::NexradFileRequest> request =
             std::make_shared<request::NexradFileRequest>();
@@ -386,15 +395,32 @@ void MainWindow::on_actionOpenNexrad_triggered()
                {
                   QMessageBox* messageBox = new QMessageBox(this);
                   messageBox->setIcon(QMessageBox::Warning);
-                  messageBox->setText(
-                     QString("%1\n%2").arg(tr("Unrecognized NEXRAD Product:"),
-                                           QDir::toNativeSeparators(file)));
+                  messageBox->setText(QString("%1\n%2").arg(
+                     tr("Unrecognized NEXRAD Product:"),
+                     QDir::toNativeSeparators(files.front())));
                   messageBox->setAttribute(Qt::WA_DeleteOnClose);
                   messageBox->open();
                }
             });
 
-         manager::RadarProductManager::LoadFile(file.toStdString(), request);
+         if (files.size() == 1)
+         {
+            manager::RadarProductManager::LoadFile(files.front().toStdString(),
+                                                   request);
+         }
+         else
+         {
+            // Chunk filenames are sequential within a volume
+            files.sort();
+
+            std::vector<std::string> filenames {};
+            for (auto& file : files)
+            {
+               filenames.push_back(file.toStdString());
+            }
+
+            manager::RadarProductManager::LoadLevel2Chunks(filenames, request);
+         }
       });
 
    dialog->open();
@@ -1,6 +1,7 @@
 #include <scwx/qt/manager/radar_product_manager.hpp>
 #include <scwx/qt/manager/radar_product_manager_notifier.hpp>
-#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/manager/settings_manager.hpp>
+#include <scwx/qt/util/radial_projector.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
 #include <scwx/util/logger.hpp>
@@ -9,8 +10,10 @@
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 
+#include <atomic>
 #include <deque>
 #include <execution>
+#include <map>
 #include <mutex>
 #include <shared_mutex>
 #include <unordered_set>
@@ -27,6 +30,7 @@
 #include <boost/timer/timer.hpp>
 #include <fmt/chrono.h>
 #include <QMapLibreGL/QMapLibreGL>
+#include <QStandardPaths>
 
 #if defined(_MSC_VER)
 #   pragma warning(pop)
@@ -64,6 +68,11 @@ static const std::string kDefaultLevel3Product_ {"N0B"};
 
 static constexpr std::chrono::seconds kRetryInterval_ {15};
 
+static constexpr std::size_t kMaxConcurrentLevel3Loads_ {4u};
+
+// Maximum size of the decoded Level 2 volume cache, about 20 volumes
+static constexpr std::uintmax_t kLevel2CacheSizeLimit_ {2ull << 30};
+
 static std::unordered_map<std::string, std::weak_ptr<RadarProductManager>>
                          instanceMap_;
 static std::shared_mutex instanceMutex_;
@@ -176,16 +185,20 @@ public:
                        providerManager->Disable();
                     });
 
+      // Level 3 loads complete under the load level 3 data mutex, so the
+      // level 3 load thread pool must be joined before locking it
+      threadPool_.join();
+      level3LoadThreadPool_.join();
+
       // Lock other mutexes before destroying, ensure loading is complete
       std::unique_lock loadLevel2DataLock {loadLevel2DataMutex_};
       std::unique_lock loadLevel3DataLock {loadLevel3DataMutex_};
-
-      threadPool_.join();
    }
 
    RadarProductManager* self_;
 
    boost::asio::thread_pool threadPool_ {4u};
+   boost::asio::thread_pool level3LoadThreadPool_ {kMaxConcurrentLevel3Loads_};
 
    std::shared_ptr<ProviderManager>
    GetLevel3ProviderManager(const std::string& product);
@@ -204,6 +217,10 @@ public:
                           std::chrono::system_clock::time_point time);
    std::shared_ptr<types::RadarProductRecord>
    StoreRadarProductRecord(std::shared_ptr<types::RadarProductRecord> record);
+   std::shared_ptr<types::RadarProductRecord>
+   StoreLevel3ProductRecord(std::shared_ptr<types::RadarProductRecord> record);
+   void StoreLevel3ProductRecords(
+      std::vector<std::shared_ptr<types::RadarProductRecord>>& records);
    void UpdateRecentRecords(RadarProductRecordList& recentList,
                             std::shared_ptr<types::RadarProductRecord> record);
 
@@ -211,6 +228,15 @@ public:
                             std::shared_ptr<request::NexradFileRequest> request,
                             std::mutex&                                 mutex,
                             std::chrono::system_clock::time_point       time);
+   void DispatchLevel3Loads();
+   std::shared_ptr<types::RadarProductRecord>
+   LoadLevel3ProductRecord(std::shared_ptr<ProviderManager> providerManager,
+                           std::chrono::system_clock::time_point time);
+   void CompleteLevel3Loads(
+      const std::vector<std::pair<std::shared_ptr<ProviderManager>,
+                                  std::chrono::system_clock::time_point>>&
+                                                                     loads,
+      const std::vector<std::shared_ptr<types::RadarProductRecord>>& records);
    void LoadProviderData(std::chrono::system_clock::time_point time,
                          std::shared_ptr<ProviderManager>      providerManager,
                          RadarProductRecordMap&                recordMap,
@@ -262,6 +288,15 @@ public:
    std::mutex loadLevel2DataMutex_;
    std::mutex loadLevel3DataMutex_;
 
+   // Level 3 loads awaiting dispatch, and the requests for each product and
+   // time being loaded. Protected by the load level 3 data mutex.
+   std::vector<std::pair<std::shared_ptr<ProviderManager>,
+                         std::chrono::system_clock::time_point>>
+      pendingLevel3Loads_ {};
+   std::map<std::pair<std::string, std::chrono::system_clock::time_point>,
+            std::vector<std::shared_ptr<request::NexradFileRequest>>>
+      level3LoadsInFlight_ {};
+
    common::Level3ProductCategoryMap availableCategoryMap_;
    std::shared_mutex                availableCategoryMutex_;
 
@@ -412,46 +447,37 @@ void RadarProductManager::Initialize()
 
    boost::timer::cpu_timer timer;
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
-
-   const QMapLibreGL::Coordinate radar(p->radarSite_->latitude(),
-                                       p->radarSite_->longitude());
-
    const float gateSize = gate_size();
 
+   // Project each radial from the radar site, to the extent of the gates
+   const util::RadialProjector projector {
+      p->radarSite_->latitude(),
+      p->radarSite_->longitude(),
+      gateSize * common::MAX_DATA_MOMENT_GATES};
+
    // Calculate half degree azimuth coordinates
    timer.start();
    std::vector<float>& coordinates0_5Degree = p->coordinates0_5Degree_;
 
    coordinates0_5Degree.resize(NUM_COORIDNATES_0_5_DEGREE);
 
-   auto radialGates0_5Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_0_5_DEGREE);
+   auto radials0_5Degree =
+      boost::irange<uint32_t>(0, common::MAX_0_5_DEGREE_RADIALS);
 
    std::for_each(
       std::execution::par_unseq,
-      radialGates0_5Degree.begin(),
-      radialGates0_5Degree.end(),
-      [&](uint32_t radialGate)
+      radials0_5Degree.begin(),
+      radials0_5Degree.end(),
+      [&](uint32_t radial)
       {
-         const uint16_t gate =
-            static_cast<uint16_t>(radialGate % common::MAX_DATA_MOMENT_GATES);
-         const uint16_t radial =
-            static_cast<uint16_t>(radialGate / common::MAX_DATA_MOMENT_GATES);
-
-         const float  angle  = radial * 0.5f - 0.25f; // 0.5 degree radial
-         const float  range  = (gate + 1) * gateSize;
-         const size_t offset = radialGate * 2;
-
-         double latitude;
-         double longitude;
-
-         geodesic.Direct(
-            radar.first, radar.second, angle, range, latitude, longitude);
-
-         coordinates0_5Degree[offset]     = latitude;
-         coordinates0_5Degree[offset + 1] = longitude;
+         const float angle = radial * 0.5f - 0.25f; // 0.5 degree radial
+
+         projector.Project(angle,
+                           gateSize,
+                           gateSize,
+                           std::span<float> {coordinates0_5Degree}.subspan(
+                              radial * common::MAX_DATA_MOMENT_GATES * 2,
+                              common::MAX_DATA_MOMENT_GATES * 2));
       });
    timer.stop();
    logger_->debug("Coordinates (0.5 degree) calculated in {}",
@@ -463,32 +489,23 @@ void RadarProductManager::Initialize()
 
    coordinates1Degree.resize(NUM_COORIDNATES_1_DEGREE);
 
-   auto radialGates1Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_1_DEGREE);
+   auto radials1Degree =
+      boost::irange<uint32_t>(0, common::MAX_1_DEGREE_RADIALS);
 
    std::for_each(
       std::execution::par_unseq,
-      radialGates1Degree.begin(),
-      radialGates1Degree.end(),
-      [&](uint32_t radialGate)
+      radials1Degree.begin(),
+      radials1Degree.end(),
+      [&](uint32_t radial)
       {
-         const uint16_t gate =
-            static_cast<uint16_t>(radialGate % common::MAX_DATA_MOMENT_GATES);
-         const uint16_t radial =
-            static_cast<uint16_t>(radialGate / common::MAX_DATA_MOMENT_GATES);
-
-         const float  angle  = radial * 1.0f - 0.5f; // 1 degree radial
-         const float  range  = (gate + 1) * gateSize;
-         const size_t offset = radialGate * 2;
-
-         double latitude;
-         double longitude;
-
-         geodesic.Direct(
-            radar.first, radar.second, angle, range, latitude, longitude);
-
-         coordinates1Degree[offset]     = latitude;
-         coordinates1Degree[offset + 1] = longitude;
+         const float angle = radial * 1.0f - 0.5f; // 1 degree radial
+
+         projector.Project(angle,
+                           gateSize,
+                           gateSize,
+                           std::span<float> {coordinates1Degree}.subspan(
+                              radial * common::MAX_DATA_MOMENT_GATES * 2,
+                              common::MAX_DATA_MOMENT_GATES * 2));
       });
    timer.stop();
    logger_->debug("Coordinates (1 degree) calculated in {}",
@@ -857,29 +874,224 @@ void RadarProductManager::LoadLevel3Data(
 {
    logger_->debug("LoadLevel3Data: {}", scwx::util::TimeString(time));
 
-   // Look up provider manager
+   LoadLevel3Data(std::vector<Level3DataLoad> {{product, time, request}});
+}
+
+void RadarProductManager::LoadLevel3Data(
+   const std::vector<Level3DataLoad>& products)
+{
+   logger_->debug("LoadLevel3Data: {} products", products.size());
+
+   // Look up provider managers
+   std::vector<std::tuple<std::shared_ptr<ProviderManager>,
+                          std::chrono::system_clock::time_point,
+                          std::shared_ptr<request::NexradFileRequest>>>
+      loads {};
+
    std::shared_lock providerManagerLock(p->level3ProviderManagerMutex_);
-   auto level3ProviderManager = p->level3ProviderManagerMap_.find(product);
-   if (level3ProviderManager == p->level3ProviderManagerMap_.cend())
+   for (auto& load : products)
    {
-      logger_->debug("No level 3 provider manager for product: {}", product);
-      return;
+      auto level3ProviderManager =
+         p->level3ProviderManagerMap_.find(load.product_);
+      if (level3ProviderManager != p->level3ProviderManagerMap_.cend())
+      {
+         loads.emplace_back(
+            level3ProviderManager->second, load.time_, load.request_);
+      }
+      else
+      {
+         logger_->debug("No level 3 provider manager for product: {}",
+                        load.product_);
+
+         if (load.request_ != nullptr)
+         {
+            Q_EMIT load.request_->RequestComplete(load.request_);
+         }
+      }
    }
    providerManagerLock.unlock();
 
-   // Look up product record
-   std::unique_lock       productRecordLock(p->level3ProductRecordMutex_);
-   RadarProductRecordMap& level3ProductRecords =
-      p->level3ProductRecordsMap_[product];
-   productRecordLock.unlock();
+   bool dispatch = false;
 
-   // Load provider data
-   p->LoadProviderData(time,
-                       level3ProviderManager->second,
-                       level3ProductRecords,
-                       p->level3ProductRecordMutex_,
-                       p->loadLevel3DataMutex_,
-                       request);
+   {
+      std::unique_lock lock {p->loadLevel3DataMutex_};
+
+      dispatch = p->pendingLevel3Loads_.empty();
+
+      for (auto& [providerManager, time, request] : loads)
+      {
+         // A product already being loaded is not loaded again, and its
+         // requests are completed when the load in flight is stored
+         auto [it, inserted] = p->level3LoadsInFlight_.try_emplace(
+            std::make_pair(providerManager->product_, time));
+         if (request != nullptr)
+         {
+            it->second.push_back(request);
+         }
+
+         if (inserted)
+         {
+            p->pendingLevel3Loads_.emplace_back(providerManager, time);
+         }
+      }
+
+      dispatch = dispatch && !p->pendingLevel3Loads_.empty();
+   }
+
+   if (dispatch)
+   {
+      // Loads requested before the batch is dispatched join the batch
+      boost::asio::post(p->threadPool_, [this]() { p->DispatchLevel3Loads(); });
+   }
+}
+
+void RadarProductManagerImpl::DispatchLevel3Loads()
+{
+   std::vector<std::pair<std::shared_ptr<ProviderManager>,
+                         std::chrono::system_clock::time_point>>
+      loads {};
+
+   {
+      std::unique_lock lock {loadLevel3DataMutex_};
+      loads.swap(pendingLevel3Loads_);
+   }
+
+   if (loads.empty())
+   {
+      return;
+   }
+
+   logger_->debug("DispatchLevel3Loads: {} products", loads.size());
+
+   // Each product is loaded independently. The last product to complete
+   // stores the batch, so that all products are published together.
+   struct Level3LoadBatch
+   {
+      explicit Level3LoadBatch(
+         std::vector<std::pair<std::shared_ptr<ProviderManager>,
+                               std::chrono::system_clock::time_point>>&&
+            loads) :
+          loads_ {std::move(loads)},
+          records_(loads_.size()),
+          remaining_ {loads_.size()}
+      {
+      }
+
+      std::vector<std::pair<std::shared_ptr<ProviderManager>,
+                            std::chrono::system_clock::time_point>>
+                                                              loads_;
+      std::vector<std::shared_ptr<types::RadarProductRecord>> records_;
+      std::atomic<std::size_t>                                remaining_;
+   };
+
+   auto batch = std::make_shared<Level3LoadBatch>(std::move(loads));
+
+   for (std::size_t i = 0; i < batch->loads_.size(); ++i)
+   {
+      boost::asio::post(
+         level3LoadThreadPool_,
+         [=, this]()
+         {
+            auto& [providerManager, time] = batch->loads_[i];
+
+            batch->records_[i] = LoadLevel3ProductRecord(providerManager, time);
+
+            if (--batch->remaining_ == 0)
+            {
+               StoreLevel3ProductRecords(batch->records_);
+               CompleteLevel3Loads(batch->loads_, batch->records_);
+            }
+         });
+   }
+}
+
+void RadarProductManagerImpl::CompleteLevel3Loads(
+   const std::vector<std::pair<std::shared_ptr<ProviderManager>,
+                               std::chrono::system_clock::time_point>>& loads,
+   const std::vector<std::shared_ptr<types::RadarProductRecord>>& records)
+{
+   std::vector<std::pair<std::shared_ptr<request::NexradFileRequest>,
+                         std::shared_ptr<types::RadarProductRecord>>>
+      requests {};
+
+   {
+      std::unique_lock lock {loadLevel3DataMutex_};
+
+      for (std::size_t i = 0; i < loads.size(); ++i)
+      {
+         auto it = level3LoadsInFlight_.find(
+            std::make_pair(loads[i].first->product_, loads[i].second));
+         if (it != level3LoadsInFlight_.cend())
+         {
+            for (auto& request : it->second)
+            {
+               requests.emplace_back(request, records[i]);
+            }
+
+            level3LoadsInFlight_.erase(it);
+         }
+      }
+   }
+
+   for (auto& [request, record] : requests)
+   {
+      request->set_radar_product_record(record);
+      Q_EMIT request->RequestComplete(request);
+   }
+}
+
+std::shared_ptr<types::RadarProductRecord>
+RadarProductManagerImpl::LoadLevel3ProductRecord(
+   std::shared_ptr<ProviderManager>      providerManager,
+   std::chrono::system_clock::time_point time)
+{
+   std::shared_ptr<types::RadarProductRecord> record = nullptr;
+
+   {
+      std::shared_lock lock {level3ProductRecordMutex_};
+
+      auto recordMap = level3ProductRecordsMap_.find(providerManager->product_);
+      if (recordMap != level3ProductRecordsMap_.cend())
+      {
+         auto it = recordMap->second.find(time);
+         if (it != recordMap->second.cend())
+         {
+            record = it->second.lock();
+         }
+      }
+   }
+
+   if (record != nullptr)
+   {
+      logger_->debug("[{}] Data previously loaded, loading from data cache",
+                     providerManager->name());
+      return record;
+   }
+
+   std::string key = providerManager->provider_->FindKey(time);
+   if (key.empty())
+   {
+      logger_->warn("[{}] Attempting to load object without key: {}",
+                    providerManager->name(),
+                    scwx::util::TimeString(time));
+      return nullptr;
+   }
+
+   std::shared_ptr<wsr88d::NexradFile> nexradFile =
+      providerManager->provider_->LoadObjectByKey(key);
+
+   if (nexradFile != nullptr)
+   {
+      record = types::RadarProductRecord::Create(nexradFile);
+
+      // If the time is already determined, override the time in the file
+      if (time != std::chrono::system_clock::time_point {})
+      {
+         record->set_time(time);
+      }
+   }
+
+   return record;
 }
 
 void RadarProductManager::LoadData(
@@ -919,6 +1131,15 @@ void RadarProductManager::LoadFile(
 
    if (existingRecord == nullptr)
    {
+      // Decoded Archive II volumes are cached unless disabled, so reopening a
+      // file does not require decompressing and decoding it again
+      const bool cacheEnabled =
+         SettingsManager::general_settings().level2_cache_enabled().GetValue();
+      const std::string cacheDirectory =
+         QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            .toStdString() +
+         "/level2";
+
       QObject::connect(request.get(),
                        &request::NexradFileRequest::RequestComplete,
                        [=](std::shared_ptr<request::NexradFileRequest> request)
@@ -937,7 +1158,15 @@ void RadarProductManager::LoadFile(
          {
             RadarProductManagerImpl::LoadNexradFile(
                [=]() -> std::shared_ptr<wsr88d::NexradFile>
-               { return wsr88d::NexradFileFactory::Create(filename); },
+               {
+                  if (!cacheEnabled)
+                  {
+                     return wsr88d::NexradFileFactory::Create(filename);
+                  }
+
+                  return wsr88d::NexradFileFactory::Create(
+                     filename, cacheDirectory, kLevel2CacheSizeLimit_);
+               },
                request,
                fileLoadMutex_);
          });
@@ -949,6 +1178,71 @@ void RadarProductManager::LoadFile(
    }
 }
 
+void RadarProductManager::LoadLevel2Chunks(
+   const std::vector<std::string>&             filenames,
+   std::shared_ptr<request::NexradFileRequest> request)
+{
+   logger_->debug("LoadLevel2Chunks: {} chunks", filenames.size());
+
+   scwx::util::async(
+      [=]()
+      {
+         auto level2File = std::make_shared<wsr88d::Ar2vFile>();
+         std::shared_ptr<types::RadarProductRecord> record  = nullptr;
+         std::shared_ptr<RadarProductManager>       manager = nullptr;
+
+         level2File->SetElevationCompleteCallback(
+            [&](std::uint16_t /* elevationIndex */, float elevation)
+            {
+               logger_->debug("Elevation complete: {}", elevation);
+
+               if (record != nullptr)
+               {
+                  Q_EMIT manager->DataReloaded(record);
+               }
+            });
+
+         for (auto& filename : filenames)
+         {
+            if (!level2File->LoadChunkFile(filename))
+            {
+               logger_->warn("Could not load chunk: {}", filename);
+               break;
+            }
+
+            if (record == nullptr)
+            {
+               // The first chunk contains the volume header, store the record
+               record  = types::RadarProductRecord::Create(level2File);
+               manager = RadarProductManager::Instance(record->radar_id());
+
+               manager->Initialize();
+               auto storedRecord = manager->p->StoreRadarProductRecord(record);
+
+               if (request != nullptr)
+               {
+                  request->set_radar_product_record(storedRecord);
+                  Q_EMIT request->RequestComplete(request);
+               }
+
+               if (storedRecord != record)
+               {
+                  logger_->debug("Volume previously loaded, stopping");
+                  break;
+               }
+            }
+         }
+
+         // The callback references local variables
+         level2File->SetElevationCompleteCallback(nullptr);
+
+         if (record == nullptr && request != nullptr)
+         {
+            Q_EMIT request->RequestComplete(request);
+         }
+      });
+}
+
 void RadarProductManagerImpl::LoadNexradFileAsync(
    CreateNexradFileFunction                    load,
    std::shared_ptr<request::NexradFileRequest> request,
@@ -1182,23 +1476,35 @@ RadarProductManagerImpl::GetLevel3ProductRecord(
    if (recordPtr != nullptr && record == nullptr &&
        recordTime != std::chrono::system_clock::time_point {})
    {
-      // Product is expired, reload it
-      std::shared_ptr<request::NexradFileRequest> request =
-         std::make_shared<request::NexradFileRequest>();
+      bool inFlight = false;
+      {
+         std::unique_lock loadLock {loadLevel3DataMutex_};
+         inFlight = level3LoadsInFlight_.contains(
+            std::make_pair(product, recordTime));
+      }
 
-      QObject::connect(
-         request.get(),
-         &request::NexradFileRequest::RequestComplete,
-         self_,
-         [this](std::shared_ptr<request::NexradFileRequest> request)
-         {
-            if (request->radar_product_record() != nullptr)
+      // Product is expired, reload it. A load already in flight is not
+      // repeated.
+      if (!inFlight)
+      {
+         std::shared_ptr<request::NexradFileRequest> request =
+            std::make_shared<request::NexradFileRequest>();
+
+         QObject::connect(
+            request.get(),
+            &request::NexradFileRequest::RequestComplete,
+            self_,
+            [this](std::shared_ptr<request::NexradFileRequest> request)
             {
-               Q_EMIT self_->DataReloaded(request->radar_product_record());
-            }
-         });
+               if (request->radar_product_record() != nullptr)
+               {
+                  Q_EMIT self_->DataReloaded(request->radar_product_record());
+               }
+            });
 
-      self_->LoadLevel3Data(product, recordTime, request);
+         self_->LoadLevel3Data(
+            std::vector<Level3DataLoad> {{product, recordTime, request}});
+      }
    }
 
    return {record, recordTime};
@@ -1244,30 +1550,62 @@ RadarProductManagerImpl::StoreRadarProductRecord(
    {
       std::unique_lock lock {level3ProductRecordMutex_};
 
-      auto& productMap = level3ProductRecordsMap_[record->radar_product()];
+      storedRecord = StoreLevel3ProductRecord(record);
+   }
 
-      auto it = productMap.find(timeInSeconds);
-      if (it != productMap.cend())
-      {
-         storedRecord = it->second.lock();
+   return storedRecord;
+}
 
-         if (storedRecord != nullptr)
-         {
-            logger_->debug(
-               "Level 3 product previously loaded, loading from cache");
-         }
+void RadarProductManagerImpl::StoreLevel3ProductRecords(
+   std::vector<std::shared_ptr<types::RadarProductRecord>>& records)
+{
+   logger_->debug("StoreLevel3ProductRecords: {} records", records.size());
+
+   std::unique_lock lock {level3ProductRecordMutex_};
+
+   for (auto& record : records)
+   {
+      if (record != nullptr)
+      {
+         record = StoreLevel3ProductRecord(record);
       }
+   }
+}
 
-      if (storedRecord == nullptr)
+std::shared_ptr<types::RadarProductRecord>
+RadarProductManagerImpl::StoreLevel3ProductRecord(
+   std::shared_ptr<types::RadarProductRecord> record)
+{
+   // The level 3 product record mutex must be held by the caller
+   std::shared_ptr<types::RadarProductRecord> storedRecord = nullptr;
+
+   auto timeInSeconds =
+      std::chrono::time_point_cast<std::chrono::seconds,
+                                   std::chrono::system_clock>(record->time());
+
+   auto& productMap = level3ProductRecordsMap_[record->radar_product()];
+
+   auto it = productMap.find(timeInSeconds);
+   if (it != productMap.cend())
+   {
+      storedRecord = it->second.lock();
+
+      if (storedRecord != nullptr)
       {
-         storedRecord              = record;
-         productMap[timeInSeconds] = record;
+         logger_->debug(
+            "Level 3 product previously loaded, loading from cache");
       }
+   }
 
-      UpdateRecentRecords(
-         level3ProductRecentRecordsMap_[record->radar_product()], storedRecord);
+   if (storedRecord == nullptr)
+   {
+      storedRecord              = record;
+      productMap[timeInSeconds] = record;
    }
 
+   UpdateRecentRecords(level3ProductRecentRecordsMap_[record->radar_product()],
+                       storedRecord);
+
    return storedRecord;
 }
 
@@ -1299,29 +1637,42 @@ void RadarProductManagerImpl::UpdateRecentRecords(
    }
 }
 
-std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+std::tuple<std::shared_ptr<wsr88d::rda::PackedElevationScan>,
            float,
            std::vector<float>,
-           std::chrono::system_clock::time_point>
+           std::chrono::system_clock::time_point,
+           std::shared_ptr<wsr88d::Ar2vFile>>
 RadarProductManager::GetLevel2Data(wsr88d::rda::DataBlockType dataBlockType,
                                    float                      elevation,
                                    std::chrono::system_clock::time_point time)
 {
-   std::shared_ptr<wsr88d::rda::ElevationScan> radarData    = nullptr;
-   float                                       elevationCut = 0.0f;
-   std::vector<float>                          elevationCuts;
+   std::shared_ptr<wsr88d::rda::PackedElevationScan> radarData    = nullptr;
+   float                                             elevationCut = 0.0f;
+   std::vector<float>                                elevationCuts;
+   std::shared_ptr<wsr88d::Ar2vFile>                 level2File   = nullptr;
 
    std::shared_ptr<types::RadarProductRecord> record;
-   std::tie(record, time) = p->GetLevel2ProductRecord(time);
+   std::chrono::system_clock::time_point      foundTime;
+   std::tie(record, foundTime) = p->GetLevel2ProductRecord(time);
 
    if (record != nullptr)
    {
+      // Select the elevation cut closest to the requested time, as the
+      // volume may contain supplemental cuts at the same elevation angle
+      level2File = record->level2_file();
       std::tie(radarData, elevationCut, elevationCuts) =
-         record->level2_file()->GetElevationScan(
-            dataBlockType, elevation, time);
+         level2File->GetPackedElevationScan(dataBlockType, elevation, time);
+   }
+
+   if (radarData != nullptr)
+   {
+      // Report the time of the selected cut, so a subsequent request for the
+      // found time selects the same cut. Never report a time prior to the
+      // record time, which would select the previous record.
+      foundTime = std::max(foundTime, radarData->start_time());
    }
 
-   return {radarData, elevationCut, elevationCuts, time};
+   return {radarData, elevationCut, elevationCuts, foundTime, level2File};
 }
 
 std::tuple<std::shared_ptr<wsr88d::rpg::Level3Message>,
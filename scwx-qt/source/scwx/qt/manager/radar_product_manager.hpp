@@ -25,6 +25,17 @@ namespace manager
 
 class RadarProductManagerImpl;
 
+/**
+ * @brief A level 3 product to load, with an optional request that is
+ * completed once the product is stored.
+ */
+struct Level3DataLoad
+{
+   std::string                                 product_;
+   std::chrono::system_clock::time_point       time_;
+   std::shared_ptr<request::NexradFileRequest> request_ {nullptr};
+};
+
 class RadarProductManager : public QObject
 {
    Q_OBJECT
@@ -83,12 +94,13 @@ public:
     * @param [in] time Radar product time
     *
     * @return Level 2 radar data, selected elevation cut, available elevation
-    * cuts and selected time
+    * cuts, selected time and the Level 2 file containing the radar data
     */
-   std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+   std::tuple<std::shared_ptr<wsr88d::rda::PackedElevationScan>,
               float,
               std::vector<float>,
-              std::chrono::system_clock::time_point>
+              std::chrono::system_clock::time_point,
+              std::shared_ptr<wsr88d::Ar2vFile>>
    GetLevel2Data(wsr88d::rda::DataBlockType            dataBlockType,
                  float                                 elevation,
                  std::chrono::system_clock::time_point time = {});
@@ -117,6 +129,18 @@ public:
       std::chrono::system_clock::time_point       time,
       std::shared_ptr<request::NexradFileRequest> request = nullptr);
 
+   /**
+    * @brief Loads level 3 data for multiple products concurrently. Products
+    * are downloaded and decoded in parallel, with bounded concurrency, and are
+    * stored together once every product has loaded. Loads requested before a
+    * batch is dispatched join the same batch, and a product and time already
+    * being loaded is not loaded again. DataReloaded is emitted for each stored
+    * record, and each request is completed once its record is stored.
+    *
+    * @param [in] products Radar products to load
+    */
+   void LoadLevel3Data(const std::vector<Level3DataLoad>& products);
+
    static void
    LoadData(std::istream&                               is,
             std::shared_ptr<request::NexradFileRequest> request = nullptr);
@@ -124,6 +148,19 @@ public:
    LoadFile(const std::string&                          filename,
             std::shared_ptr<request::NexradFileRequest> request = nullptr);
 
+   /**
+    * @brief Incrementally loads a level 2 volume from a sequence of real-time
+    * chunk files. The radar product record is stored, and the request is
+    * completed, once the first chunk has been loaded. DataReloaded is emitted
+    * each time an elevation cut completes.
+    *
+    * @param [in] filenames Chunk filenames, in order
+    * @param [in] request Request to complete once the record is available
+    */
+   static void LoadLevel2Chunks(
+      const std::vector<std::string>&             filenames,
+      std::shared_ptr<request::NexradFileRequest> request = nullptr);
+
    common::Level3ProductCategoryMap GetAvailableLevel3Categories();
    std::vector<std::string>         GetLevel3Products();
 
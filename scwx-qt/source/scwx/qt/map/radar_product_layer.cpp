@@ -28,6 +28,22 @@ namespace map
 static constexpr uint32_t MAX_RADIALS           = 720;
 static constexpr uint32_t MAX_DATA_MOMENT_GATES = 1840;
 
+// Indexed mesh buffers, bound as buffer textures starting at texture unit 1
+static constexpr std::size_t kMeshCoordinates_  = 0u;
+static constexpr std::size_t kMeshGates_        = 1u;
+static constexpr std::size_t kMeshDataMoments_  = 2u;
+static constexpr std::size_t kMeshCfpMoments_   = 3u;
+static constexpr std::size_t kMeshBufferCount_  = 4u;
+static constexpr GLint       kMeshTextureUnit_  = 1;
+
+// Largest indexed mesh buffer, in texels. The coordinate grid contains one
+// texel per gate of a full super resolution sweep.
+static constexpr std::size_t kMaxMeshTexels_ =
+   MAX_RADIALS * MAX_DATA_MOMENT_GATES;
+
+static const std::array<std::string, kMeshBufferCount_> kMeshSamplers_ {
+   "uMeshCoordinates", "uMeshGates", "uMeshDataMoments", "uMeshCfpMoments"};
+
 static const std::string logPrefix_ = "scwx::qt::map::radar_product_layer";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
@@ -44,10 +60,19 @@ public:
        uDataMomentOffsetLocation_(GL_INVALID_INDEX),
        uDataMomentScaleLocation_(GL_INVALID_INDEX),
        uCFPEnabledLocation_(GL_INVALID_INDEX),
+       uMeshEnabledLocation_(GL_INVALID_INDEX),
+       uMeshRadialsLocation_(GL_INVALID_INDEX),
+       uMeshCenterLocation_(GL_INVALID_INDEX),
        vbo_ {GL_INVALID_INDEX},
        vao_ {GL_INVALID_INDEX},
        texture_ {GL_INVALID_INDEX},
        numVertices_ {0},
+       meshBuffers_ {GL_INVALID_INDEX},
+       meshTextures_ {GL_INVALID_INDEX},
+       meshCoordinates_ {nullptr},
+       numMeshGates_ {0},
+       meshEnabled_ {false},
+       maxTextureBufferSize_ {0},
        cfpEnabled_ {false},
        colorTableNeedsUpdate_ {false},
        sweepNeedsUpdate_ {false}
@@ -55,6 +80,8 @@ public:
    }
    ~RadarProductLayerImpl() = default;
 
+   bool MeshFitsTextureBuffers(const view::RadarMesh& mesh) const;
+
    std::shared_ptr<gl::ShaderProgram> shaderProgram_;
 
    GLint                 uMVPMatrixLocation_;
@@ -62,12 +89,22 @@ public:
    GLint                 uDataMomentOffsetLocation_;
    GLint                 uDataMomentScaleLocation_;
    GLint                 uCFPEnabledLocation_;
+   GLint                 uMeshEnabledLocation_;
+   GLint                 uMeshRadialsLocation_;
+   GLint                 uMeshCenterLocation_;
    std::array<GLuint, 3> vbo_;
    GLuint                vao_;
    GLuint                texture_;
 
    GLsizeiptr numVertices_;
 
+   std::array<GLuint, kMeshBufferCount_>     meshBuffers_;
+   std::array<GLuint, kMeshBufferCount_>     meshTextures_;
+   std::shared_ptr<const std::vector<float>> meshCoordinates_;
+   GLsizei                                   numMeshGates_;
+   bool                                      meshEnabled_;
+   GLint                                     maxTextureBufferSize_;
+
    bool cfpEnabled_;
 
    bool colorTableNeedsUpdate_;
@@ -134,8 +171,60 @@ void RadarProductLayer::Initialize()
       logger_->warn("Could not find uCFPEnabled");
    }
 
+   p->uMeshEnabledLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uMeshEnabled");
+   if (p->uMeshEnabledLocation_ == -1)
+   {
+      logger_->warn("Could not find uMeshEnabled");
+   }
+
+   p->uMeshRadialsLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uMeshRadials");
+   if (p->uMeshRadialsLocation_ == -1)
+   {
+      logger_->warn("Could not find uMeshRadials");
+   }
+
+   p->uMeshCenterLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uMeshCenter");
+   if (p->uMeshCenterLocation_ == -1)
+   {
+      logger_->warn("Could not find uMeshCenter");
+   }
+
    p->shaderProgram_->Use();
 
+   // Assign a texture unit to each indexed mesh buffer
+   for (std::size_t i = 0; i < kMeshBufferCount_; ++i)
+   {
+      const GLint location = gl.glGetUniformLocation(
+         p->shaderProgram_->id(), kMeshSamplers_[i].c_str());
+      if (location == -1)
+      {
+         logger_->warn("Could not find {}", kMeshSamplers_[i]);
+      }
+
+      gl.glUniform1i(location, kMeshTextureUnit_ + static_cast<GLint>(i));
+   }
+
+   // Indexed meshes are bound as buffer textures. Where the maximum buffer
+   // texture size is too small for a full sweep (the OpenGL 3.3 minimum is
+   // 65536 texels), views also build expanded vertices.
+   gl.glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &p->maxTextureBufferSize_);
+   if (static_cast<std::size_t>(p->maxTextureBufferSize_) < kMaxMeshTexels_)
+   {
+      logger_->info("Maximum texture buffer size of {} texels is below {}, "
+                    "using expanded vertices",
+                    p->maxTextureBufferSize_,
+                    kMaxMeshTexels_);
+
+      context()->radar_product_view()->set_expand_vertices(true);
+   }
+
+   // Generate indexed mesh buffers and buffer textures
+   gl.glGenBuffers(kMeshBufferCount_, p->meshBuffers_.data());
+   gl.glGenTextures(kMeshBufferCount_, p->meshTextures_.data());
+
    // Generate a vertex array object
    gl.glGenVertexArrays(1, &p->vao_);
 
@@ -176,6 +265,32 @@ void RadarProductLayer::UpdateSweep()
 
    p->sweepNeedsUpdate_ = false;
 
+   // Prefer the indexed mesh, if supported by the view and the mesh fits in
+   // the buffer textures
+   const view::RadarMesh* mesh = radarProductView->mesh();
+   if (mesh != nullptr && mesh->coordinates_ != nullptr)
+   {
+      if (p->MeshFitsTextureBuffers(*mesh))
+      {
+         UpdateMesh(*mesh);
+         return;
+      }
+
+      if (!radarProductView->expand_vertices())
+      {
+         // Expanded vertices are buffered once the sweep is recomputed
+         logger_->info("Mesh exceeds maximum texture buffer size of {} texels, "
+                       "using expanded vertices",
+                       p->maxTextureBufferSize_);
+
+         radarProductView->set_expand_vertices(true);
+      }
+   }
+
+   p->meshEnabled_     = false;
+   p->meshCoordinates_ = nullptr;
+   gl.glUniform1i(p->uMeshEnabledLocation_, 0);
+
    const std::vector<float>& vertices = radarProductView->vertices();
 
    // Bind a vertex array object
@@ -257,6 +372,108 @@ void RadarProductLayer::UpdateSweep()
    p->numVertices_ = vertices.size() / 2;
 }
 
+void RadarProductLayer::UpdateMesh(const view::RadarMesh& mesh)
+{
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   boost::timer::cpu_timer timer;
+
+   timer.start();
+
+   // The coordinate grid is only buffered when it changes, typically when the
+   // radar site or azimuth layout changes
+   if (mesh.coordinates_ != p->meshCoordinates_)
+   {
+      const std::vector<float>& coordinates = *mesh.coordinates_;
+
+      gl.glBindBuffer(GL_TEXTURE_BUFFER, p->meshBuffers_[kMeshCoordinates_]);
+      gl.glBufferData(GL_TEXTURE_BUFFER,
+                      coordinates.size() * sizeof(GLfloat),
+                      coordinates.data(),
+                      GL_STATIC_DRAW);
+
+      p->meshCoordinates_ = mesh.coordinates_;
+
+      logger_->debug("Mesh coordinates buffered ({} bytes)",
+                     coordinates.size() * sizeof(GLfloat));
+   }
+
+   // Buffer gate references and data moments for the sweep
+   const bool dataMoments16 = !mesh.dataMoments16_.empty();
+
+   gl.glBindBuffer(GL_TEXTURE_BUFFER, p->meshBuffers_[kMeshGates_]);
+   gl.glBufferData(GL_TEXTURE_BUFFER,
+                   mesh.gates_.size() * sizeof(GLuint),
+                   mesh.gates_.data(),
+                   GL_STREAM_DRAW);
+
+   gl.glBindBuffer(GL_TEXTURE_BUFFER, p->meshBuffers_[kMeshDataMoments_]);
+   if (dataMoments16)
+   {
+      gl.glBufferData(GL_TEXTURE_BUFFER,
+                      mesh.dataMoments16_.size() * sizeof(GLushort),
+                      mesh.dataMoments16_.data(),
+                      GL_STREAM_DRAW);
+   }
+   else
+   {
+      gl.glBufferData(GL_TEXTURE_BUFFER,
+                      mesh.dataMoments8_.size() * sizeof(GLubyte),
+                      mesh.dataMoments8_.data(),
+                      GL_STREAM_DRAW);
+   }
+
+   gl.glBindBuffer(GL_TEXTURE_BUFFER, p->meshBuffers_[kMeshCfpMoments_]);
+   gl.glBufferData(GL_TEXTURE_BUFFER,
+                   mesh.cfpMoments_.size() * sizeof(GLubyte),
+                   mesh.cfpMoments_.data(),
+                   GL_STREAM_DRAW);
+
+   gl.glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+   timer.stop();
+   logger_->debug("Mesh buffered in {} ({} bytes)",
+                  timer.format(6, "%ws"),
+                  mesh.sweep_data_size());
+
+   // Attach each buffer to its buffer texture
+   const std::array<GLenum, kMeshBufferCount_> formats {
+      GL_RG32F, GL_R32UI, dataMoments16 ? GL_R16UI : GL_R8UI, GL_R8UI};
+
+   for (std::size_t i = 0; i < kMeshBufferCount_; ++i)
+   {
+      gl.glActiveTexture(GL_TEXTURE0 + kMeshTextureUnit_ +
+                         static_cast<GLenum>(i));
+      gl.glBindTexture(GL_TEXTURE_BUFFER, p->meshTextures_[i]);
+      gl.glTexBuffer(GL_TEXTURE_BUFFER, formats[i], p->meshBuffers_[i]);
+   }
+   gl.glActiveTexture(GL_TEXTURE0);
+
+   // Vertices are generated from the mesh, disable vertex attributes
+   gl.glBindVertexArray(p->vao_);
+   gl.glDisableVertexAttribArray(0);
+   gl.glDisableVertexAttribArray(1);
+   gl.glDisableVertexAttribArray(2);
+
+   gl.glUniform1i(p->uMeshEnabledLocation_, 1);
+   gl.glUniform1ui(p->uMeshRadialsLocation_, mesh.radials_);
+   gl.glUniform2f(p->uMeshCenterLocation_, mesh.latitude_, mesh.longitude_);
+
+   p->numMeshGates_ = static_cast<GLsizei>(mesh.gate_count());
+   p->meshEnabled_  = true;
+}
+
+bool RadarProductLayerImpl::MeshFitsTextureBuffers(
+   const view::RadarMesh& mesh) const
+{
+   const std::size_t maxTexels =
+      static_cast<std::size_t>(std::max<GLint>(maxTextureBufferSize_, 0));
+
+   // Gate references and moments each contain one texel per gate
+   return mesh.coordinates_->size() / 2 <= maxTexels &&
+          mesh.gate_count() <= maxTexels;
+}
+
 void RadarProductLayer::Render(
    const QMapLibreGL::CustomLayerRenderParameters& params)
 {
@@ -301,7 +518,27 @@ void RadarProductLayer::Render(
    gl.glActiveTexture(GL_TEXTURE0);
    gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
    gl.glBindVertexArray(p->vao_);
-   gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+
+   if (p->meshEnabled_)
+   {
+      for (std::size_t i = 0; i < kMeshBufferCount_; ++i)
+      {
+         gl.glActiveTexture(GL_TEXTURE0 + kMeshTextureUnit_ +
+                            static_cast<GLenum>(i));
+         gl.glBindTexture(GL_TEXTURE_BUFFER, p->meshTextures_[i]);
+      }
+      gl.glActiveTexture(GL_TEXTURE0);
+
+      constexpr GLsizei kVerticesPerGate =
+         static_cast<GLsizei>(view::RadarMesh::kVerticesPerGate);
+
+      gl.glDrawArrays(
+         GL_TRIANGLES, 0, p->numMeshGates_ * kVerticesPerGate);
+   }
+   else
+   {
+      gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+   }
 
    SCWX_GL_CHECK_ERROR();
 }
@@ -314,15 +551,24 @@ void RadarProductLayer::Deinitialize()
 
    gl.glDeleteVertexArrays(1, &p->vao_);
    gl.glDeleteBuffers(3, p->vbo_.data());
+   gl.glDeleteTextures(kMeshBufferCount_, p->meshTextures_.data());
+   gl.glDeleteBuffers(kMeshBufferCount_, p->meshBuffers_.data());
 
    p->uMVPMatrixLocation_        = GL_INVALID_INDEX;
    p->uMapScreenCoordLocation_   = GL_INVALID_INDEX;
    p->uDataMomentOffsetLocation_ = GL_INVALID_INDEX;
    p->uDataMomentScaleLocation_  = GL_INVALID_INDEX;
    p->uCFPEnabledLocation_       = GL_INVALID_INDEX;
+   p->uMeshEnabledLocation_      = GL_INVALID_INDEX;
+   p->uMeshRadialsLocation_      = GL_INVALID_INDEX;
+   p->uMeshCenterLocation_       = GL_INVALID_INDEX;
    p->vao_                       = GL_INVALID_INDEX;
    p->vbo_                       = {GL_INVALID_INDEX};
    p->texture_                   = GL_INVALID_INDEX;
+   p->meshBuffers_               = {GL_INVALID_INDEX};
+   p->meshTextures_              = {GL_INVALID_INDEX};
+   p->meshCoordinates_           = nullptr;
+   p->meshEnabled_               = false;
 }
 
 void RadarProductLayer::UpdateColorTable()
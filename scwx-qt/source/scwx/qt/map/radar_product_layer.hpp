@@ -1,6 +1,7 @@
 #pragma once
 
 #include <scwx/qt/map/generic_layer.hpp>
+#include <scwx/qt/view/radar_mesh.hpp>
 
 namespace scwx
 {
@@ -23,6 +24,7 @@ public:
 
 private:
    void UpdateColorTable();
+   void UpdateMesh(const view::RadarMesh& mesh);
    void UpdateSweep();
 
 private:
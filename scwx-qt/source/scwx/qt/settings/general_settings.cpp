@@ -38,9 +38,12 @@ public:
       loopTime_.SetDefault(30);
       gridWidth_.SetDefault(1);
       gridHeight_.SetDefault(1);
+      level2CacheEnabled_.SetDefault(true);
       mapProvider_.SetDefault(defaultMapProviderValue);
       mapboxApiKey_.SetDefault("?");
       maptilerApiKey_.SetDefault("?");
+      precomputeSweepsEnabled_.SetDefault(false);
+      precomputeSweepsMemoryLimit_.SetDefault(512);
       updateNotificationsEnabled_.SetDefault(true);
 
       fontSizes_.SetElementMinimum(1);
@@ -57,6 +60,8 @@ public:
       loopSpeed_.SetMaximum(99.99);
       loopTime_.SetMinimum(1);
       loopTime_.SetMaximum(1440);
+      precomputeSweepsMemoryLimit_.SetMinimum(64);
+      precomputeSweepsMemoryLimit_.SetMaximum(8192);
 
       defaultAlertAction_.SetValidator(
          [](const std::string& value)
@@ -110,12 +115,16 @@ public:
    SettingsContainer<std::vector<std::int64_t>> fontSizes_ {"font_sizes"};
    SettingsVariable<std::int64_t>               gridWidth_ {"grid_width"};
    SettingsVariable<std::int64_t>               gridHeight_ {"grid_height"};
+   SettingsVariable<bool> level2CacheEnabled_ {"level2_cache"};
    SettingsVariable<std::int64_t>               loopDelay_ {"loop_delay"};
    SettingsVariable<double>                     loopSpeed_ {"loop_speed"};
    SettingsVariable<std::int64_t>               loopTime_ {"loop_time"};
    SettingsVariable<std::string>                mapProvider_ {"map_provider"};
    SettingsVariable<std::string> mapboxApiKey_ {"mapbox_api_key"};
    SettingsVariable<std::string> maptilerApiKey_ {"maptiler_api_key"};
+   SettingsVariable<bool> precomputeSweepsEnabled_ {"precompute_sweeps"};
+   SettingsVariable<std::int64_t> precomputeSweepsMemoryLimit_ {
+      "precompute_sweeps_memory_limit"};
    SettingsVariable<bool> updateNotificationsEnabled_ {"update_notifications"};
 };
 
@@ -128,12 +137,15 @@ GeneralSettings::GeneralSettings() :
                       &p->fontSizes_,
                       &p->gridWidth_,
                       &p->gridHeight_,
+                      &p->level2CacheEnabled_,
                       &p->loopDelay_,
                       &p->loopSpeed_,
                       &p->loopTime_,
                       &p->mapProvider_,
                       &p->mapboxApiKey_,
                       &p->maptilerApiKey_,
+                      &p->precomputeSweepsEnabled_,
+                      &p->precomputeSweepsMemoryLimit_,
                       &p->updateNotificationsEnabled_});
    SetDefaults();
 }
@@ -174,6 +186,11 @@ SettingsVariable<std::int64_t>& GeneralSettings::grid_width() const
    return p->gridWidth_;
 }
 
+SettingsVariable<bool>& GeneralSettings::level2_cache_enabled() const
+{
+   return p->level2CacheEnabled_;
+}
+
 SettingsVariable<std::int64_t>& GeneralSettings::loop_delay() const
 {
    return p->loopDelay_;
@@ -204,6 +221,17 @@ SettingsVariable<std::string>& GeneralSettings::maptiler_api_key() const
    return p->maptilerApiKey_;
 }
 
+SettingsVariable<bool>& GeneralSettings::precompute_sweeps_enabled() const
+{
+   return p->precomputeSweepsEnabled_;
+}
+
+SettingsVariable<std::int64_t>&
+GeneralSettings::precompute_sweeps_memory_limit() const
+{
+   return p->precomputeSweepsMemoryLimit_;
+}
+
 SettingsVariable<bool>& GeneralSettings::update_notifications_enabled() const
 {
    return p->updateNotificationsEnabled_;
@@ -229,12 +257,16 @@ bool operator==(const GeneralSettings& lhs, const GeneralSettings& rhs)
            lhs.p->fontSizes_ == rhs.p->fontSizes_ &&
            lhs.p->gridWidth_ == rhs.p->gridWidth_ &&
            lhs.p->gridHeight_ == rhs.p->gridHeight_ &&
+           lhs.p->level2CacheEnabled_ == rhs.p->level2CacheEnabled_ &&
            lhs.p->loopDelay_ == rhs.p->loopDelay_ &&
            lhs.p->loopSpeed_ == rhs.p->loopSpeed_ &&
            lhs.p->loopTime_ == rhs.p->loopTime_ &&
            lhs.p->mapProvider_ == rhs.p->mapProvider_ &&
            lhs.p->mapboxApiKey_ == rhs.p->mapboxApiKey_ &&
            lhs.p->maptilerApiKey_ == rhs.p->maptilerApiKey_ &&
+           lhs.p->precomputeSweepsEnabled_ == rhs.p->precomputeSweepsEnabled_ &&
+           lhs.p->precomputeSweepsMemoryLimit_ ==
+              rhs.p->precomputeSweepsMemoryLimit_ &&
            lhs.p->updateNotificationsEnabled_ ==
               rhs.p->updateNotificationsEnabled_);
 }
@@ -33,12 +33,15 @@ public:
    SettingsContainer<std::vector<std::int64_t>>& font_sizes() const;
    SettingsVariable<std::int64_t>&               grid_height() const;
    SettingsVariable<std::int64_t>&               grid_width() const;
+   SettingsVariable<bool>&                       level2_cache_enabled() const;
    SettingsVariable<std::int64_t>&               loop_delay() const;
    SettingsVariable<double>&                     loop_speed() const;
    SettingsVariable<std::int64_t>&               loop_time() const;
    SettingsVariable<std::string>&                map_provider() const;
    SettingsVariable<std::string>&                mapbox_api_key() const;
    SettingsVariable<std::string>&                maptiler_api_key() const;
+   SettingsVariable<bool>&         precompute_sweeps_enabled() const;
+   SettingsVariable<std::int64_t>& precompute_sweeps_memory_limit() const;
    SettingsVariable<bool>& update_notifications_enabled() const;
 
    friend bool operator==(const GeneralSettings& lhs,
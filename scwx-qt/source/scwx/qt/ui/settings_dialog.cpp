@@ -90,6 +90,9 @@ public:
           &mapboxApiKey_,
           &mapTilerApiKey_,
           &defaultAlertAction_,
+          &level2CacheEnabled_,
+          &precomputeSweepsEnabled_,
+          &precomputeSweepsMemoryLimit_,
           &updateNotificationsEnabled_,
           &debugEnabled_}}
    {
@@ -146,9 +149,12 @@ public:
    settings::SettingsInterface<std::string>               mapProvider_ {};
    settings::SettingsInterface<std::string>               mapboxApiKey_ {};
    settings::SettingsInterface<std::string>               mapTilerApiKey_ {};
-   settings::SettingsInterface<std::string> defaultAlertAction_ {};
-   settings::SettingsInterface<bool>        updateNotificationsEnabled_ {};
-   settings::SettingsInterface<bool>        debugEnabled_ {};
+   settings::SettingsInterface<std::string>  defaultAlertAction_ {};
+   settings::SettingsInterface<bool>         level2CacheEnabled_ {};
+   settings::SettingsInterface<bool>         precomputeSweepsEnabled_ {};
+   settings::SettingsInterface<std::int64_t> precomputeSweepsMemoryLimit_ {};
+   settings::SettingsInterface<bool>         updateNotificationsEnabled_ {};
+   settings::SettingsInterface<bool>         debugEnabled_ {};
 
    std::unordered_map<std::string, settings::SettingsInterface<std::string>>
       colorTables_ {};
@@ -401,6 +407,22 @@ void SettingsDialogImpl::SetupGeneralTab()
    defaultAlertAction_.SetEditWidget(self_->ui->defaultAlertActionComboBox);
    defaultAlertAction_.SetResetButton(self_->ui->resetDefaultAlertActionButton);
 
+   level2CacheEnabled_.SetSettingsVariable(
+      generalSettings.level2_cache_enabled());
+   level2CacheEnabled_.SetEditWidget(self_->ui->level2CacheCheckBox);
+
+   precomputeSweepsEnabled_.SetSettingsVariable(
+      generalSettings.precompute_sweeps_enabled());
+   precomputeSweepsEnabled_.SetEditWidget(
+      self_->ui->precomputeSweepsCheckBox);
+
+   precomputeSweepsMemoryLimit_.SetSettingsVariable(
+      generalSettings.precompute_sweeps_memory_limit());
+   precomputeSweepsMemoryLimit_.SetEditWidget(
+      self_->ui->precomputeSweepsMemoryLimitSpinBox);
+   precomputeSweepsMemoryLimit_.SetResetButton(
+      self_->ui->resetPrecomputeSweepsMemoryLimitButton);
+
    updateNotificationsEnabled_.SetSettingsVariable(
       generalSettings.update_notifications_enabled());
    updateNotificationsEnabled_.SetEditWidget(
@@ -0,0 +1,286 @@
+#include <scwx/qt/util/polar_coordinate_cache.hpp>
+#include <scwx/qt/util/radial_projector.hpp>
+#include <scwx/common/constants.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/range/irange.hpp>
+#include <boost/timer/timer.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::polar_coordinate_cache";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+typedef std::pair<PolarGridKey, std::shared_ptr<const std::vector<float>>>
+   PolarGridEntry;
+
+static std::size_t EntrySize(const PolarGridEntry& entry);
+
+class PolarCoordinateCache::Impl
+{
+public:
+   explicit Impl(std::size_t memoryLimit) :
+       memoryLimit_ {memoryLimit},
+       memoryUsage_ {0},
+       hitCount_ {0},
+       missCount_ {0},
+       entries_ {},
+       entryMap_ {},
+       mutex_ {}
+   {
+   }
+   ~Impl() = default;
+
+   void Trim();
+
+   std::size_t memoryLimit_;
+   std::size_t memoryUsage_;
+   std::size_t hitCount_;
+   std::size_t missCount_;
+
+   // Most recently used entries are at the front of the list
+   std::list<PolarGridEntry> entries_;
+   std::unordered_map<PolarGridKey,
+                      std::list<PolarGridEntry>::iterator,
+                      PolarGridHash>
+                      entryMap_;
+   mutable std::mutex mutex_;
+};
+
+PolarCoordinateCache::PolarCoordinateCache(std::size_t memoryLimit) :
+    p(std::make_unique<Impl>(memoryLimit))
+{
+}
+PolarCoordinateCache::~PolarCoordinateCache() = default;
+
+PolarCoordinateCache::PolarCoordinateCache(PolarCoordinateCache&&) noexcept =
+   default;
+PolarCoordinateCache&
+PolarCoordinateCache::operator=(PolarCoordinateCache&&) noexcept = default;
+
+PolarCoordinateCache& PolarCoordinateCache::Instance()
+{
+   static PolarCoordinateCache instance_ {};
+   return instance_;
+}
+
+std::size_t PolarCoordinateCache::hit_count() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->hitCount_;
+}
+
+std::size_t PolarCoordinateCache::memory_limit() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->memoryLimit_;
+}
+
+std::size_t PolarCoordinateCache::memory_usage() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->memoryUsage_;
+}
+
+std::size_t PolarCoordinateCache::miss_count() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->missCount_;
+}
+
+std::size_t PolarCoordinateCache::size() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->entries_.size();
+}
+
+std::shared_ptr<const std::vector<float>>
+PolarCoordinateCache::GetCoordinates(const PolarGridKey& key)
+{
+   {
+      std::unique_lock lock {p->mutex_};
+
+      auto it = p->entryMap_.find(key);
+      if (it != p->entryMap_.cend())
+      {
+         ++p->hitCount_;
+
+         // Move the entry to the front of the list
+         p->entries_.splice(p->entries_.begin(), p->entries_, it->second);
+         return it->second->second;
+      }
+
+      ++p->missCount_;
+   }
+
+   // Calculate coordinates without holding the lock
+   auto coordinates =
+      std::make_shared<const std::vector<float>>(CalculateCoordinates(key));
+
+   std::unique_lock lock {p->mutex_};
+
+   auto it = p->entryMap_.find(key);
+   if (it != p->entryMap_.cend())
+   {
+      // Coordinates were calculated concurrently, use the cached entry
+      p->entries_.splice(p->entries_.begin(), p->entries_, it->second);
+      return it->second->second;
+   }
+
+   p->entries_.emplace_front(key, coordinates);
+   p->entryMap_.emplace(key, p->entries_.begin());
+   p->memoryUsage_ += EntrySize(p->entries_.front());
+   p->Trim();
+
+   logger_->trace("Polar grid cache: {} hits, {} misses, {} bytes",
+                  p->hitCount_,
+                  p->missCount_,
+                  p->memoryUsage_);
+
+   return coordinates;
+}
+
+void PolarCoordinateCache::Clear()
+{
+   std::unique_lock lock {p->mutex_};
+   p->entries_.clear();
+   p->entryMap_.clear();
+   p->memoryUsage_ = 0;
+}
+
+void PolarCoordinateCache::SetMemoryLimit(std::size_t memoryLimit)
+{
+   std::unique_lock lock {p->mutex_};
+   p->memoryLimit_ = memoryLimit;
+   p->Trim();
+}
+
+void PolarCoordinateCache::Impl::Trim()
+{
+   while (memoryUsage_ > memoryLimit_ && !entries_.empty())
+   {
+      // Remove the least recently used entry. Views holding the coordinates
+      // keep them alive until the next sweep.
+      memoryUsage_ -= EntrySize(entries_.back());
+      entryMap_.erase(entries_.back().first);
+      entries_.pop_back();
+   }
+}
+
+PolarGridKey PolarCoordinateCache::CreateKey(double                 latitude,
+                                             double                 longitude,
+                                             float                  gateSize,
+                                             std::uint16_t          rangeBins,
+                                             std::span<const float> azimuths)
+{
+   PolarGridKey key {.latitude_  = latitude,
+                     .longitude_ = longitude,
+                     .gateSize_  = gateSize,
+                     .rangeBins_ = rangeBins,
+                     .azimuths_  = {}};
+
+   key.azimuths_.resize(azimuths.size());
+   std::transform(azimuths.begin(),
+                  azimuths.end(),
+                  key.azimuths_.begin(),
+                  [](float azimuth)
+                  {
+                     return static_cast<std::int32_t>(
+                        std::lround(azimuth * kAzimuthScale));
+                  });
+
+   return key;
+}
+
+std::vector<float>
+PolarCoordinateCache::CalculateCoordinates(const PolarGridKey& key)
+{
+   boost::timer::cpu_timer timer;
+
+   const std::size_t numRadials = key.azimuths_.size();
+   if (numRadials == 0)
+   {
+      return {};
+   }
+
+   // Range bins of the final radial may extend past the maximum number of
+   // data moment gates
+   const std::size_t numCoordinates =
+      (numRadials - 1) * common::MAX_DATA_MOMENT_GATES + key.rangeBins_;
+
+   std::vector<float> coordinates(numCoordinates * 2);
+
+   auto radials = boost::irange<std::uint32_t>(
+      0u, static_cast<std::uint32_t>(numRadials));
+
+   const RadialProjector projector {
+      key.latitude_, key.longitude_, key.rangeBins_ * key.gateSize_};
+
+   std::for_each(
+      std::execution::par_unseq,
+      radials.begin(),
+      radials.end(),
+      [&](std::uint32_t radial)
+      {
+         const float azimuth = key.azimuths_[radial] / kAzimuthScale;
+         const float previousAzimuth =
+            key.azimuths_[(radial == 0) ? numRadials - 1 : radial - 1] /
+            kAzimuthScale;
+
+         // Angles are ordered clockwise, delta should be positive. Only correct
+         // less than -90 degrees, this should cover any "overlap" scenarios.
+         float deltaAngle = azimuth - previousAzimuth;
+         while (deltaAngle < -90.0f)
+         {
+            deltaAngle += 360.0f;
+         }
+
+         const float angle = azimuth - (deltaAngle * 0.5f);
+
+         projector.Project(
+            angle,
+            key.gateSize_,
+            key.gateSize_,
+            std::span<float> {coordinates}.subspan(
+               radial * common::MAX_DATA_MOMENT_GATES * 2, key.rangeBins_ * 2));
+      });
+
+   timer.stop();
+   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+
+   return coordinates;
+}
+
+size_t PolarGridHash::operator()(const PolarGridKey& x) const
+{
+   size_t seed = 0;
+   boost::hash_combine(seed, x.latitude_);
+   boost::hash_combine(seed, x.longitude_);
+   boost::hash_combine(seed, x.gateSize_);
+   boost::hash_combine(seed, x.rangeBins_);
+   boost::hash_range(seed, x.azimuths_.cbegin(), x.azimuths_.cend());
+   return seed;
+}
+
+static std::size_t EntrySize(const PolarGridEntry& entry)
+{
+   return entry.first.azimuths_.size() * sizeof(std::int32_t) +
+          entry.second->size() * sizeof(float);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Parameters which uniquely determine the coordinates of a polar grid.
+ */
+struct PolarGridKey
+{
+   double                    latitude_;  ///< Radar latitude in degrees
+   double                    longitude_; ///< Radar longitude in degrees
+   float                     gateSize_;  ///< Gate size in meters
+   std::uint16_t             rangeBins_; ///< Number of range bins per radial
+   std::vector<std::int32_t> azimuths_;  ///< Radial azimuths in 0.01 degrees
+
+   bool operator==(const PolarGridKey& o) const = default;
+};
+
+struct PolarGridHash
+{
+   size_t operator()(const PolarGridKey& x) const;
+};
+
+/**
+ * @brief Bounded, least recently used cache of polar grid coordinates, shared
+ * by each radar product view.
+ *
+ * Coordinates are stored as latitude/longitude pairs, indexed by
+ * radial * MAX_DATA_MOMENT_GATES + gate. Each coordinate is located at the far
+ * edge of the gate, on the counterclockwise edge of the radial.
+ */
+class PolarCoordinateCache
+{
+public:
+   explicit PolarCoordinateCache(
+      std::size_t memoryLimit = kDefaultMemoryLimit);
+   ~PolarCoordinateCache();
+
+   PolarCoordinateCache(const PolarCoordinateCache&)            = delete;
+   PolarCoordinateCache& operator=(const PolarCoordinateCache&) = delete;
+
+   PolarCoordinateCache(PolarCoordinateCache&&) noexcept;
+   PolarCoordinateCache& operator=(PolarCoordinateCache&&) noexcept;
+
+   /**
+    * Default memory limit in bytes, enough for 12 super resolution grids.
+    */
+   static constexpr std::size_t kDefaultMemoryLimit = 128u * 1024u * 1024u;
+
+   /**
+    * Azimuths are quantized to this many units per degree.
+    */
+   static constexpr float kAzimuthScale = 100.0f;
+
+   static PolarCoordinateCache& Instance();
+
+   std::size_t hit_count() const;
+   std::size_t memory_limit() const;
+   std::size_t memory_usage() const;
+   std::size_t miss_count() const;
+   std::size_t size() const;
+
+   /**
+    * Gets the coordinates of a polar grid, calculating and caching them if not
+    * already present.
+    *
+    * @param key Polar grid parameters
+    *
+    * @return Polar grid coordinates
+    */
+   std::shared_ptr<const std::vector<float>>
+   GetCoordinates(const PolarGridKey& key);
+
+   void Clear();
+   void SetMemoryLimit(std::size_t memoryLimit);
+
+   /**
+    * Creates a polar grid key, quantizing the radial azimuths.
+    *
+    * @param latitude Radar latitude in degrees
+    * @param longitude Radar longitude in degrees
+    * @param gateSize Gate size in meters
+    * @param rangeBins Number of range bins per radial
+    * @param azimuths Radial azimuths in degrees
+    *
+    * @return Polar grid key
+    */
+   static PolarGridKey CreateKey(double                 latitude,
+                                 double                 longitude,
+                                 float                  gateSize,
+                                 std::uint16_t          rangeBins,
+                                 std::span<const float> azimuths);
+
+   static std::vector<float> CalculateCoordinates(const PolarGridKey& key);
+
+private:
+   class Impl;
+
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
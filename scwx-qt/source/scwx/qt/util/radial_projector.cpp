@@ -0,0 +1,345 @@
+#include <scwx/qt/util/radial_projector.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <execution>
+#include <numbers>
+
+#include <boost/range/irange.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::radial_projector";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::array<std::size_t, 6> kCandidateDegrees_ {
+   4u, 6u, 8u, 12u, 16u, 24u};
+static constexpr std::size_t kMaxDegree_ = kCandidateDegrees_.back();
+
+// The series degree is validated along radials at this azimuth interval, at
+// evenly spaced ranges
+static constexpr double      kValidationAzimuthStep_ = 15.0;
+static constexpr std::size_t kValidationPoints_      = 128u;
+
+// Require the validated error to be within this fraction of the error bound,
+// to allow for error between validation points
+static constexpr double kValidationMargin_ = 0.5;
+
+struct RadialSeries
+{
+   std::array<double, kMaxDegree_ + 1> latitude_;
+   std::array<double, kMaxDegree_ + 1> longitude_;
+};
+
+class RadialProjector::Impl
+{
+public:
+   explicit Impl(double latitude,
+                 double longitude,
+                 double maxRange,
+                 double maxError) :
+       geodesic_ {GeographicLib::DefaultGeodesic()},
+       latitude_ {latitude},
+       longitude_ {longitude},
+       maxRange_ {maxRange},
+       maxError_ {maxError},
+       degree_ {0}
+   {
+   }
+   ~Impl() = default;
+
+   void   Evaluate(const RadialSeries& series,
+                   std::size_t         degree,
+                   double              range,
+                   double&             latitude,
+                   double&             longitude) const;
+   void   Fit(double azimuth, std::size_t degree, RadialSeries& series) const;
+   double MaxError(std::size_t degree) const;
+   void   SelectDegree();
+   void   Solve(double  azimuth,
+                double  range,
+                double& latitude,
+                double& longitude) const;
+
+   template<class T>
+   void Project(double       azimuth,
+                double       firstRange,
+                double       rangeInterval,
+                std::span<T> coordinates) const;
+
+   const ::GeographicLib::Geodesic& geodesic_;
+
+   double      latitude_;
+   double      longitude_;
+   double      maxRange_;
+   double      maxError_;
+   std::size_t degree_;
+};
+
+RadialProjector::RadialProjector(double latitude,
+                                 double longitude,
+                                 double maxRange,
+                                 double maxError) :
+    p(std::make_unique<Impl>(latitude, longitude, maxRange, maxError))
+{
+   p->SelectDegree();
+}
+RadialProjector::~RadialProjector() = default;
+
+RadialProjector::RadialProjector(RadialProjector&&) noexcept = default;
+RadialProjector&
+RadialProjector::operator=(RadialProjector&&) noexcept = default;
+
+std::size_t RadialProjector::degree() const
+{
+   return p->degree_;
+}
+
+double RadialProjector::latitude() const
+{
+   return p->latitude_;
+}
+
+double RadialProjector::longitude() const
+{
+   return p->longitude_;
+}
+
+double RadialProjector::max_error() const
+{
+   return p->maxError_;
+}
+
+double RadialProjector::max_range() const
+{
+   return p->maxRange_;
+}
+
+void RadialProjector::Project(double           azimuth,
+                              double           firstRange,
+                              double           rangeInterval,
+                              std::span<float> coordinates) const
+{
+   p->Project(azimuth, firstRange, rangeInterval, coordinates);
+}
+
+void RadialProjector::Project(double            azimuth,
+                              double            firstRange,
+                              double            rangeInterval,
+                              std::span<double> coordinates) const
+{
+   p->Project(azimuth, firstRange, rangeInterval, coordinates);
+}
+
+void RadialProjector::Impl::Solve(double  azimuth,
+                                  double  range,
+                                  double& latitude,
+                                  double& longitude) const
+{
+   geodesic_.Direct(latitude_, longitude_, azimuth, range, latitude, longitude);
+
+   // Longitude is relative to the radar, such that radials crossing the
+   // antimeridian are continuous
+   longitude = std::remainder(longitude - longitude_, 360.0);
+}
+
+void RadialProjector::Impl::Fit(double        azimuth,
+                                std::size_t   degree,
+                                RadialSeries& series) const
+{
+   const std::size_t nodes = degree + 1;
+
+   std::array<double, kMaxDegree_ + 1> latitudes;
+   std::array<double, kMaxDegree_ + 1> longitudes;
+
+   // Solve exactly at the Chebyshev nodes
+   for (std::size_t k = 0; k < nodes; ++k)
+   {
+      const double x = std::cos(std::numbers::pi * (k + 0.5) / nodes);
+      Solve(azimuth, (x + 1.0) * 0.5 * maxRange_, latitudes[k], longitudes[k]);
+   }
+
+   for (std::size_t j = 0; j < nodes; ++j)
+   {
+      double latitude  = 0.0;
+      double longitude = 0.0;
+
+      for (std::size_t k = 0; k < nodes; ++k)
+      {
+         const double c = std::cos(std::numbers::pi * j * (k + 0.5) / nodes);
+         latitude += latitudes[k] * c;
+         longitude += longitudes[k] * c;
+      }
+
+      // The first coefficient is halved, such that evaluation is uniform
+      const double scale   = ((j == 0) ? 1.0 : 2.0) / nodes;
+      series.latitude_[j]  = latitude * scale;
+      series.longitude_[j] = longitude * scale;
+   }
+}
+
+void RadialProjector::Impl::Evaluate(const RadialSeries& series,
+                                     std::size_t         degree,
+                                     double              range,
+                                     double&             latitude,
+                                     double&             longitude) const
+{
+   // Clenshaw recurrence, with range mapped to [-1, 1]
+   const double t  = range / maxRange_ * 2.0 - 1.0;
+   const double t2 = t * 2.0;
+
+   double lat1 = 0.0;
+   double lat2 = 0.0;
+   double lon1 = 0.0;
+   double lon2 = 0.0;
+
+   for (std::size_t k = degree; k > 0; --k)
+   {
+      const double lat0 = t2 * lat1 - lat2 + series.latitude_[k];
+      const double lon0 = t2 * lon1 - lon2 + series.longitude_[k];
+
+      lat2 = lat1;
+      lat1 = lat0;
+      lon2 = lon1;
+      lon1 = lon0;
+   }
+
+   latitude  = t * lat1 - lat2 + series.latitude_[0];
+   longitude = t * lon1 - lon2 + series.longitude_[0];
+}
+
+double RadialProjector::Impl::MaxError(std::size_t degree) const
+{
+   static const double kMetersPerDegree =
+      ::GeographicLib::Constants::WGS84_a() * std::numbers::pi / 180.0;
+
+   RadialSeries series;
+   double       maxError = 0.0;
+
+   for (double azimuth = 0.0; azimuth < 360.0;
+        azimuth += kValidationAzimuthStep_)
+   {
+      Fit(azimuth, degree, series);
+
+      for (std::size_t i = 0; i <= kValidationPoints_; ++i)
+      {
+         const double range = maxRange_ * i / kValidationPoints_;
+
+         double latitude;
+         double longitude;
+         double fitLatitude;
+         double fitLongitude;
+
+         Solve(azimuth, range, latitude, longitude);
+         Evaluate(series, degree, range, fitLatitude, fitLongitude);
+
+         const double dy = (fitLatitude - latitude) * kMetersPerDegree;
+         const double dx = (fitLongitude - longitude) * kMetersPerDegree *
+                           std::cos(latitude * std::numbers::pi / 180.0);
+
+         maxError = std::max(maxError, std::sqrt(dx * dx + dy * dy));
+      }
+   }
+
+   return maxError;
+}
+
+void RadialProjector::Impl::SelectDegree()
+{
+   degree_ = 0;
+
+   if (maxRange_ <= 0.0)
+   {
+      return;
+   }
+
+   for (std::size_t degree : kCandidateDegrees_)
+   {
+      const double error = MaxError(degree);
+      if (error <= maxError_ * kValidationMargin_)
+      {
+         logger_->debug("Selected degree {} (error: {} m)", degree, error);
+         degree_ = degree;
+         return;
+      }
+   }
+
+   logger_->warn("Error bound of {} m not met, solving each point exactly",
+                 maxError_);
+}
+
+template<class T>
+void RadialProjector::Impl::Project(double       azimuth,
+                                    double       firstRange,
+                                    double       rangeInterval,
+                                    std::span<T> coordinates) const
+{
+   const std::size_t count = coordinates.size() / 2;
+
+   // Points within the maximum range use the fitted series
+   std::size_t seriesCount = 0;
+   if (degree_ > 0 && firstRange >= 0.0 && firstRange <= maxRange_)
+   {
+      seriesCount =
+         (rangeInterval > 0.0) ?
+            std::min<std::size_t>(
+               count,
+               static_cast<std::size_t>((maxRange_ - firstRange) /
+                                        rangeInterval) +
+                  1u) :
+            count;
+   }
+
+   if (seriesCount > 0)
+   {
+      RadialSeries series;
+      Fit(azimuth, degree_, series);
+
+      auto points = boost::irange<std::size_t>(0u, seriesCount);
+
+      std::for_each(std::execution::unseq,
+                    points.begin(),
+                    points.end(),
+                    [&](std::size_t i)
+                    {
+                       const double range = firstRange + i * rangeInterval;
+
+                       double latitude;
+                       double longitude;
+
+                       Evaluate(series, degree_, range, latitude, longitude);
+
+                       coordinates[i * 2]     = static_cast<T>(latitude);
+                       coordinates[i * 2 + 1] = static_cast<T>(
+                          std::remainder(longitude + longitude_, 360.0));
+                    });
+   }
+
+   for (std::size_t i = seriesCount; i < count; ++i)
+   {
+      double latitude;
+      double longitude;
+
+      geodesic_.Direct(latitude_,
+                       longitude_,
+                       azimuth,
+                       firstRange + i * rangeInterval,
+                       latitude,
+                       longitude);
+
+      coordinates[i * 2]     = static_cast<T>(latitude);
+      coordinates[i * 2 + 1] = static_cast<T>(longitude);
+   }
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
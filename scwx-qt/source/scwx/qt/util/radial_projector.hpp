@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Fast projection of points along radials from a radar site.
+ *
+ * Latitude and longitude along a radial are approximated by Chebyshev series
+ * fitted to exact WGS84 geodesic solutions. The series degree is chosen once
+ * per site, such that the error over the site's range does not exceed the
+ * configured bound. Each radial then requires only a handful of geodesic
+ * solutions, and each point is a short, vectorizable series evaluation.
+ */
+class RadialProjector
+{
+public:
+   /**
+    * @param latitude Radar latitude in degrees
+    * @param longitude Radar longitude in degrees
+    * @param maxRange Maximum projected range in meters
+    * @param maxError Maximum projection error in meters
+    */
+   explicit RadialProjector(double latitude,
+                            double longitude,
+                            double maxRange,
+                            double maxError = kDefaultMaxError);
+   ~RadialProjector();
+
+   RadialProjector(const RadialProjector&)            = delete;
+   RadialProjector& operator=(const RadialProjector&) = delete;
+
+   RadialProjector(RadialProjector&&) noexcept;
+   RadialProjector& operator=(RadialProjector&&) noexcept;
+
+   static constexpr double kDefaultMaxError = 1.0;
+
+   /**
+    * Degree of the series used to approximate each radial. A degree of 0
+    * indicates the error bound could not be met, and each point is solved
+    * exactly.
+    */
+   std::size_t degree() const;
+   double      latitude() const;
+   double      longitude() const;
+   double      max_error() const;
+   double      max_range() const;
+
+   /**
+    * Projects evenly spaced points along a radial. Points beyond the maximum
+    * range are solved exactly.
+    *
+    * @param [in] azimuth Azimuth of the radial in degrees
+    * @param [in] firstRange Range of the first point in meters
+    * @param [in] rangeInterval Range between points in meters
+    * @param [out] coordinates Latitude/longitude pairs of each point
+    */
+   void Project(double           azimuth,
+                double           firstRange,
+                double           rangeInterval,
+                std::span<float> coordinates) const;
+   void Project(double            azimuth,
+                double            firstRange,
+                double            rangeInterval,
+                std::span<double> coordinates) const;
+
+private:
+   class Impl;
+
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
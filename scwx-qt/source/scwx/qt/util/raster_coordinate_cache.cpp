@@ -0,0 +1,238 @@
+#include <scwx/qt/util/raster_coordinate_cache.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <cmath>
+#include <execution>
+#include <list>
+#include <mutex>
+#include <numbers>
+#include <unordered_map>
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/range/irange.hpp>
+#include <boost/timer/timer.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::raster_coordinate_cache";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+typedef std::pair<RasterGridKey, std::shared_ptr<const std::vector<float>>>
+   RasterGridEntry;
+
+class RasterCoordinateCache::Impl
+{
+public:
+   explicit Impl(std::size_t capacity) :
+       capacity_ {capacity},
+       hitCount_ {0},
+       missCount_ {0},
+       entries_ {},
+       entryMap_ {},
+       mutex_ {}
+   {
+   }
+   ~Impl() = default;
+
+   void Trim();
+
+   std::size_t capacity_;
+   std::size_t hitCount_;
+   std::size_t missCount_;
+
+   // Most recently used entries are at the front of the list
+   std::list<RasterGridEntry> entries_;
+   std::unordered_map<RasterGridKey,
+                      std::list<RasterGridEntry>::iterator,
+                      RasterGridHash>
+                      entryMap_;
+   mutable std::mutex mutex_;
+};
+
+RasterCoordinateCache::RasterCoordinateCache(std::size_t capacity) :
+    p(std::make_unique<Impl>(capacity))
+{
+}
+RasterCoordinateCache::~RasterCoordinateCache() = default;
+
+RasterCoordinateCache::RasterCoordinateCache(
+   RasterCoordinateCache&&) noexcept = default;
+RasterCoordinateCache&
+RasterCoordinateCache::operator=(RasterCoordinateCache&&) noexcept = default;
+
+RasterCoordinateCache& RasterCoordinateCache::Instance()
+{
+   static RasterCoordinateCache instance_ {};
+   return instance_;
+}
+
+std::size_t RasterCoordinateCache::capacity() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->capacity_;
+}
+
+std::size_t RasterCoordinateCache::hit_count() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->hitCount_;
+}
+
+std::size_t RasterCoordinateCache::miss_count() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->missCount_;
+}
+
+std::size_t RasterCoordinateCache::size() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->entries_.size();
+}
+
+std::shared_ptr<const std::vector<float>>
+RasterCoordinateCache::GetCoordinates(const RasterGridKey& key)
+{
+   {
+      std::unique_lock lock {p->mutex_};
+
+      auto it = p->entryMap_.find(key);
+      if (it != p->entryMap_.cend())
+      {
+         ++p->hitCount_;
+
+         // Move the entry to the front of the list
+         p->entries_.splice(p->entries_.begin(), p->entries_, it->second);
+         return it->second->second;
+      }
+
+      ++p->missCount_;
+   }
+
+   // Calculate coordinates without holding the lock
+   auto coordinates =
+      std::make_shared<const std::vector<float>>(CalculateCoordinates(key));
+
+   std::unique_lock lock {p->mutex_};
+
+   auto it = p->entryMap_.find(key);
+   if (it != p->entryMap_.cend())
+   {
+      // Coordinates were calculated concurrently, use the cached entry
+      p->entries_.splice(p->entries_.begin(), p->entries_, it->second);
+      return it->second->second;
+   }
+
+   p->entries_.emplace_front(key, coordinates);
+   p->entryMap_.emplace(key, p->entries_.begin());
+   p->Trim();
+
+   return coordinates;
+}
+
+void RasterCoordinateCache::Clear()
+{
+   std::unique_lock lock {p->mutex_};
+   p->entries_.clear();
+   p->entryMap_.clear();
+}
+
+void RasterCoordinateCache::SetCapacity(std::size_t capacity)
+{
+   std::unique_lock lock {p->mutex_};
+   p->capacity_ = capacity;
+   p->Trim();
+}
+
+void RasterCoordinateCache::Impl::Trim()
+{
+   while (entries_.size() > capacity_)
+   {
+      // Remove the least recently used entry
+      entryMap_.erase(entries_.back().first);
+      entries_.pop_back();
+   }
+}
+
+std::vector<float>
+RasterCoordinateCache::CalculateCoordinates(const RasterGridKey& key)
+{
+   boost::timer::cpu_timer timer;
+
+   // Each grid point lies on its own azimuth, so the series fitted per radial
+   // by RadialProjector cannot be reused between points. Points are solved
+   // exactly, and the grid is cached.
+   const ::GeographicLib::Geodesic& geodesic =
+      GeographicLib::DefaultGeodesic();
+
+   const double iCoordinate = (-key.iStart_ - 1.0 - key.range_) * 1000.0;
+   const double jCoordinate = (key.jStart_ + 1.0 + key.range_) * 1000.0;
+
+   // For each row or column, there is one additional coordinate. Each bin is
+   // bounded by 4 coordinates.
+   const std::size_t rowCoordinates    = key.rows_ + 1u;
+   const std::size_t columnCoordinates = key.columns_ + 1u;
+   const std::size_t numCoordinates    = rowCoordinates * columnCoordinates;
+
+   auto coordinateRange =
+      boost::irange<std::uint32_t>(0, static_cast<uint32_t>(numCoordinates));
+
+   std::vector<float> coordinates(numCoordinates * 2);
+
+   std::for_each(
+      std::execution::par_unseq,
+      coordinateRange.begin(),
+      coordinateRange.end(),
+      [&](std::uint32_t index)
+      {
+         const std::size_t col = index % columnCoordinates;
+         const std::size_t row = index / columnCoordinates;
+
+         const double i = iCoordinate + key.xResolution_ * col;
+         const double j = jCoordinate - key.yResolution_ * row;
+
+         // Calculate polar coordinates based on i and j
+         const double angle  = std::atan2(i, j) * 180.0 / std::numbers::pi;
+         const double range  = std::sqrt(i * i + j * j);
+         const size_t offset = static_cast<size_t>(index) * 2;
+
+         double latitude;
+         double longitude;
+
+         geodesic.Direct(
+            key.latitude_, key.longitude_, angle, range, latitude, longitude);
+
+         coordinates[offset]     = static_cast<float>(latitude);
+         coordinates[offset + 1] = static_cast<float>(longitude);
+      });
+
+   timer.stop();
+   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+
+   return coordinates;
+}
+
+size_t RasterGridHash::operator()(const RasterGridKey& x) const
+{
+   size_t seed = 0;
+   boost::hash_combine(seed, x.latitude_);
+   boost::hash_combine(seed, x.longitude_);
+   boost::hash_combine(seed, x.range_);
+   boost::hash_combine(seed, x.xResolution_);
+   boost::hash_combine(seed, x.yResolution_);
+   boost::hash_combine(seed, x.iStart_);
+   boost::hash_combine(seed, x.jStart_);
+   boost::hash_combine(seed, x.rows_);
+   boost::hash_combine(seed, x.columns_);
+   return seed;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
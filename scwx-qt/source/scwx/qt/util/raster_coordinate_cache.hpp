@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Parameters which uniquely determine the coordinates of a raster grid.
+ */
+struct RasterGridKey
+{
+   float         latitude_;    ///< Radar latitude in degrees
+   float         longitude_;   ///< Radar longitude in degrees
+   float         range_;       ///< Product range in km
+   std::uint16_t xResolution_; ///< Bin width in meters
+   std::uint16_t yResolution_; ///< Bin height in meters
+   std::int16_t  iStart_;      ///< I coordinate start in km
+   std::int16_t  jStart_;      ///< J coordinate start in km
+   std::uint16_t rows_;        ///< Number of rows
+   std::uint16_t columns_;     ///< Number of columns
+
+   bool operator==(const RasterGridKey& o) const = default;
+};
+
+struct RasterGridHash
+{
+   size_t operator()(const RasterGridKey& x) const;
+};
+
+/**
+ * @brief Bounded, least recently used cache of raster grid coordinates.
+ *
+ * Coordinates are stored as latitude/longitude pairs, with one more row and
+ * column than the raster grid, such that each bin is bounded by 4 coordinates.
+ */
+class RasterCoordinateCache
+{
+public:
+   explicit RasterCoordinateCache(std::size_t capacity = kDefaultCapacity);
+   ~RasterCoordinateCache();
+
+   RasterCoordinateCache(const RasterCoordinateCache&)            = delete;
+   RasterCoordinateCache& operator=(const RasterCoordinateCache&) = delete;
+
+   RasterCoordinateCache(RasterCoordinateCache&&) noexcept;
+   RasterCoordinateCache& operator=(RasterCoordinateCache&&) noexcept;
+
+   static constexpr std::size_t kDefaultCapacity = 16u;
+
+   static RasterCoordinateCache& Instance();
+
+   std::size_t capacity() const;
+   std::size_t hit_count() const;
+   std::size_t miss_count() const;
+   std::size_t size() const;
+
+   /**
+    * Gets the coordinates of a raster grid, calculating and caching them if
+    * not already present.
+    *
+    * @param key Raster grid parameters
+    *
+    * @return Raster grid coordinates
+    */
+   std::shared_ptr<const std::vector<float>>
+   GetCoordinates(const RasterGridKey& key);
+
+   void Clear();
+   void SetCapacity(std::size_t capacity);
+
+   static std::vector<float> CalculateCoordinates(const RasterGridKey& key);
+
+private:
+   class Impl;
+
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -1,10 +1,20 @@
 #include <scwx/qt/view/level2_product_view.hpp>
-#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/manager/settings_manager.hpp>
+#include <scwx/qt/util/polar_coordinate_cache.hpp>
+#include <scwx/qt/view/radial_sweep.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 
@@ -18,13 +28,7 @@ namespace view
 static const std::string logPrefix_ = "scwx::qt::view::level2_product_view";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
-static constexpr std::uint32_t kMaxRadialGates_ =
-   common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
-static constexpr std::uint32_t kMaxCoordinates_ = kMaxRadialGates_ * 2u;
-
-static constexpr uint16_t RANGE_FOLDED      = 1u;
-static constexpr uint32_t VERTICES_PER_BIN  = 6u;
-static constexpr uint32_t VALUES_PER_VERTEX = 2u;
+static constexpr uint16_t RANGE_FOLDED = 1u;
 
 static const std::unordered_map<common::Level2Product,
                                 wsr88d::rda::DataBlockType>
@@ -52,7 +56,7 @@ public:
        product_ {product},
        selectedElevation_ {0.0f},
        elevationScan_ {nullptr},
-       momentDataBlock0_ {nullptr},
+       sweepDataBlockType_ {wsr88d::rda::DataBlockType::Unknown},
        latitude_ {},
        longitude_ {},
        elevationCut_ {},
@@ -68,14 +72,56 @@ public:
        savedScale_ {0.0f},
        savedOffset_ {0.0f}
    {
-      coordinates_.resize(kMaxCoordinates_);
-
       SetProduct(product);
    }
-   ~Level2ProductViewImpl() = default;
+   ~Level2ProductViewImpl()
+   {
+      // Abandon precomputation in progress
+      ++precomputeGeneration_;
+      precomputeThreadPool_.stop();
+      precomputeThreadPool_.join();
+   }
 
-   void
-   ComputeCoordinates(std::shared_ptr<wsr88d::rda::ElevationScan> radarData);
+   typedef std::unordered_map<std::shared_ptr<wsr88d::rda::PackedElevationScan>,
+                              std::shared_ptr<RadialSweep>>
+      PrecomputedSweepMap;
+
+   static void BuildSweep(
+      const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+      const wsr88d::rda::PackedElevationScan&              radarData,
+      wsr88d::rda::DataBlockType                           dataBlockType,
+      const std::shared_ptr<const std::vector<float>>&     coordinates,
+      RadialSweep&                                         sweep,
+      bool                                                 expandVertices,
+      bool                                                 parallel);
+   static bool HasRequiredVertices(const RadialSweep& sweep,
+                                   bool               expandVertices);
+   static std::size_t
+   PackedMemoryUsage(const wsr88d::rda::PackedElevationScan& radarData,
+                     wsr88d::rda::DataBlockType              dataBlockType);
+   static std::shared_ptr<const std::vector<float>> ComputeCoordinates(
+      const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+      const wsr88d::rda::PackedElevationScan&              radarData,
+      wsr88d::rda::DataBlockType                           dataBlockType);
+
+   std::shared_ptr<RadialSweep> FindPrecomputedSweep(
+      const std::shared_ptr<wsr88d::rda::PackedElevationScan>& radarData);
+   void PrecomputeSweeps(
+      std::uint64_t                                 generation,
+      std::shared_ptr<manager::RadarProductManager> radarProductManager,
+      std::shared_ptr<wsr88d::Ar2vFile>             level2File,
+      wsr88d::rda::DataBlockType                    dataBlockType,
+      std::chrono::system_clock::time_point         time,
+      std::size_t                                   memoryLimit,
+      bool                                          expandVertices,
+      float                                         elevation,
+      std::vector<float>                            elevationCuts,
+      PrecomputedSweepMap::value_type               currentSweep);
+   void SchedulePrecompute(
+      std::shared_ptr<manager::RadarProductManager> radarProductManager,
+      std::shared_ptr<wsr88d::Ar2vFile>             level2File,
+      wsr88d::rda::DataBlockType                    dataBlockType,
+      std::chrono::system_clock::time_point         time);
 
    void SetProduct(const std::string& productName);
    void SetProduct(common::Level2Product product);
@@ -87,14 +133,18 @@ public:
 
    float selectedElevation_;
 
-   std::shared_ptr<wsr88d::rda::ElevationScan>   elevationScan_;
-   std::shared_ptr<wsr88d::rda::MomentDataBlock> momentDataBlock0_;
+   std::shared_ptr<wsr88d::rda::PackedElevationScan> elevationScan_;
+   wsr88d::rda::DataBlockType                        sweepDataBlockType_;
+
+   std::shared_ptr<const std::vector<float>> coordinates_ {};
 
-   std::vector<float>    coordinates_ {};
-   std::vector<float>    vertices_ {};
-   std::vector<uint8_t>  dataMoments8_ {};
-   std::vector<uint16_t> dataMoments16_ {};
-   std::vector<uint8_t>  cfpMoments_ {};
+   std::shared_ptr<RadialSweep> sweep_ {std::make_shared<RadialSweep>()};
+
+   // Sweeps of other elevation cuts, precomputed in the background
+   boost::asio::thread_pool   precomputeThreadPool_ {1u};
+   std::atomic<std::uint64_t> precomputeGeneration_ {0u};
+   std::mutex                 precomputeMutex_ {};
+   PrecomputedSweepMap        precomputedSweeps_ {};
 
    float              latitude_;
    float              longitude_;
@@ -215,7 +265,12 @@ uint16_t Level2ProductView::vcp() const
 
 const std::vector<float>& Level2ProductView::vertices() const
 {
-   return p->vertices_;
+   return p->sweep_->vertices_;
+}
+
+const RadarMesh* Level2ProductView::mesh() const
+{
+   return &p->sweep_->mesh_;
 }
 
 common::RadarProductGroup Level2ProductView::GetRadarProductGroup() const
@@ -239,16 +294,16 @@ std::tuple<const void*, size_t, size_t> Level2ProductView::GetMomentData() const
    size_t      dataSize;
    size_t      componentSize;
 
-   if (p->dataMoments8_.size() > 0)
+   if (p->sweep_->dataMoments8_.size() > 0)
    {
-      data          = p->dataMoments8_.data();
-      dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+      data          = p->sweep_->dataMoments8_.data();
+      dataSize      = p->sweep_->dataMoments8_.size() * sizeof(uint8_t);
       componentSize = 1;
    }
    else
    {
-      data          = p->dataMoments16_.data();
-      dataSize      = p->dataMoments16_.size() * sizeof(uint16_t);
+      data          = p->sweep_->dataMoments16_.data();
+      dataSize      = p->sweep_->dataMoments16_.size() * sizeof(uint16_t);
       componentSize = 2;
    }
 
@@ -262,10 +317,10 @@ Level2ProductView::GetCfpMomentData() const
    size_t      dataSize      = 0;
    size_t      componentSize = 1;
 
-   if (p->cfpMoments_.size() > 0)
+   if (p->sweep_->cfpMoments_.size() > 0)
    {
-      data     = p->cfpMoments_.data();
-      dataSize = p->cfpMoments_.size() * sizeof(uint8_t);
+      data     = p->sweep_->cfpMoments_.data();
+      dataSize = p->sweep_->cfpMoments_.size() * sizeof(uint8_t);
    }
 
    return std::tie(data, dataSize, componentSize);
@@ -312,16 +367,17 @@ void Level2ProductViewImpl::SetProduct(common::Level2Product product)
 
 void Level2ProductView::UpdateColorTable()
 {
-   if (p->momentDataBlock0_ == nullptr || //
-       p->colorTable_ == nullptr ||       //
+   if (p->elevationScan_ == nullptr ||                            //
+       !p->elevationScan_->has_moment(p->sweepDataBlockType_) || //
+       p->colorTable_ == nullptr ||                               //
        !p->colorTable_->IsValid())
    {
       // Nothing to update
       return;
    }
 
-   float offset = p->momentDataBlock0_->offset();
-   float scale  = p->momentDataBlock0_->scale();
+   float offset = p->elevationScan_->offset(p->sweepDataBlockType_);
+   float scale  = p->elevationScan_->scale(p->sweepDataBlockType_);
 
    if (p->savedColorTable_ == p->colorTable_ && //
        p->savedOffset_ == offset &&             //
@@ -411,10 +467,12 @@ void Level2ProductView::ComputeSweep()
    std::shared_ptr<manager::RadarProductManager> radarProductManager =
       radar_product_manager();
 
-   std::shared_ptr<wsr88d::rda::ElevationScan> radarData;
-   std::chrono::system_clock::time_point       requestedTime {selected_time()};
-   std::chrono::system_clock::time_point       foundTime;
-   std::tie(radarData, p->elevationCut_, p->elevationCuts_, foundTime) =
+   std::shared_ptr<wsr88d::rda::PackedElevationScan> radarData;
+   std::shared_ptr<wsr88d::Ar2vFile>                 level2File;
+   std::chrono::system_clock::time_point requestedTime {selected_time()};
+   std::chrono::system_clock::time_point foundTime;
+   std::tie(
+      radarData, p->elevationCut_, p->elevationCuts_, foundTime, level2File) =
       radarProductManager->GetLevel2Data(
          p->dataBlockType_, p->selectedElevation_, requestedTime);
 
@@ -429,24 +487,41 @@ void Level2ProductView::ComputeSweep()
       Q_EMIT SweepNotComputed(types::NoUpdateReason::NotLoaded);
       return;
    }
-   if (radarData == p->elevationScan_)
+   if (radarData == p->elevationScan_ &&
+       Level2ProductViewImpl::HasRequiredVertices(*p->sweep_,
+                                                  expand_vertices()))
    {
       Q_EMIT SweepNotComputed(types::NoUpdateReason::NoChange);
       return;
    }
 
-   const size_t radials = radarData->size();
+   const wsr88d::rda::DataBlockType dataBlockType = p->dataBlockType_;
 
-   p->ComputeCoordinates(radarData);
+   // Use a sweep precomputed in the background, if available
+   std::shared_ptr<RadialSweep> precomputedSweep =
+      p->FindPrecomputedSweep(radarData);
 
-   const std::vector<float>& coordinates = p->coordinates_;
+   if (precomputedSweep != nullptr &&
+       !Level2ProductViewImpl::HasRequiredVertices(*precomputedSweep,
+                                                   expand_vertices()))
+   {
+      precomputedSweep = nullptr;
+   }
+
+   if (precomputedSweep != nullptr)
+   {
+      p->coordinates_ = precomputedSweep->mesh_.coordinates_;
+   }
+   else
+   {
+      p->coordinates_ = Level2ProductViewImpl::ComputeCoordinates(
+         radarProductManager, *radarData, dataBlockType);
+   }
 
-   auto& radarData0     = (*radarData)[0];
-   auto  momentData0    = radarData0->moment_data_block(p->dataBlockType_);
-   p->elevationScan_    = radarData;
-   p->momentDataBlock0_ = momentData0;
+   p->elevationScan_      = radarData;
+   p->sweepDataBlockType_ = dataBlockType;
 
-   if (momentData0 == nullptr)
+   if (!radarData->has_moment(dataBlockType))
    {
       logger_->warn("No moment data for {}",
                     common::GetLevel2Name(p->product_));
@@ -454,330 +529,411 @@ void Level2ProductView::ComputeSweep()
       return;
    }
 
-   const uint32_t gates = momentData0->number_of_data_moment_gates();
-
-   auto radialData0 = radarData0->radial_data_block();
-   auto volumeData0 = radarData0->volume_data_block();
-   p->latitude_     = volumeData0->latitude();
-   p->longitude_    = volumeData0->longitude();
-   p->range_ =
-      momentData0->data_moment_range() +
-      momentData0->data_moment_range_sample_interval() * (gates - 0.5f);
-   p->sweepTime_ = scwx::util::TimePoint(radarData0->modified_julian_date(),
-                                         radarData0->collection_time());
-   p->vcp_       = volumeData0->volume_coverage_pattern_number();
-
-   // Calculate vertices
-   timer.start();
-
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(radials * gates * VERTICES_PER_BIN * VALUES_PER_VERTEX);
-
-   // Setup data moment vector
-   std::vector<uint8_t>&  dataMoments8  = p->dataMoments8_;
-   std::vector<uint16_t>& dataMoments16 = p->dataMoments16_;
-   std::vector<uint8_t>&  cfpMoments    = p->cfpMoments_;
-   size_t                 mIndex        = 0;
-
-   if (momentData0->data_word_size() == 8)
+   const auto numberOfDataMomentGates =
+      radarData->number_of_data_moment_gates(dataBlockType);
+   const auto dataMomentRanges =
+      radarData->data_moment_range_raw(dataBlockType);
+   const auto dataMomentIntervals =
+      radarData->data_moment_range_sample_interval_raw(dataBlockType);
+   const std::uint32_t gates = numberOfDataMomentGates[0];
+
+   p->latitude_  = radarData->latitude();
+   p->longitude_ = radarData->longitude();
+   p->range_     = dataMomentRanges[0] * 0.001f +
+               dataMomentIntervals[0] * 0.001f * (gates - 0.5f);
+   p->sweepTime_ = radarData->start_time();
+   p->vcp_       = radarData->volume_coverage_pattern_number();
+
+   if (precomputedSweep != nullptr)
    {
-      dataMoments16.resize(0);
-      dataMoments16.shrink_to_fit();
-
-      dataMoments8.resize(radials * gates * VERTICES_PER_BIN);
+      // Swap in the sweep precomputed in the background
+      p->sweep_ = precomputedSweep;
+      logger_->debug("Using precomputed sweep");
    }
    else
    {
-      dataMoments8.resize(0);
-      dataMoments8.shrink_to_fit();
+      // Calculate vertices
+      timer.start();
 
-      dataMoments16.resize(radials * gates * VERTICES_PER_BIN);
-   }
+      // The current sweep may be shared with precomputed sweeps, in which case
+      // it cannot be modified
+      if (p->sweep_.use_count() > 1)
+      {
+         p->sweep_ = std::make_shared<RadialSweep>();
+      }
 
-   if (p->dataBlockType_ == wsr88d::rda::DataBlockType::MomentRef &&
-       radarData0->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp) !=
-          nullptr)
-   {
-      cfpMoments.resize(radials * gates * VERTICES_PER_BIN);
-   }
-   else
-   {
-      cfpMoments.resize(0);
-      cfpMoments.shrink_to_fit();
+      Level2ProductViewImpl::BuildSweep(radarProductManager,
+                                        *radarData,
+                                        dataBlockType,
+                                        p->coordinates_,
+                                        *p->sweep_,
+                                        expand_vertices(),
+                                        true);
+
+      timer.stop();
+      logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+
+      p->SchedulePrecompute(
+         radarProductManager, level2File, dataBlockType, selected_time());
    }
 
+   UpdateColorTable();
+
+   Q_EMIT SweepComputed();
+}
+
+void Level2ProductViewImpl::BuildSweep(
+   const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+   const wsr88d::rda::PackedElevationScan&              radarData,
+   wsr88d::rda::DataBlockType                           dataBlockType,
+   const std::shared_ptr<const std::vector<float>>&     coordinates,
+   RadialSweep&                                         sweep,
+   bool                                                 expandVertices,
+   bool                                                 parallel)
+{
+   const std::size_t radials = radarData.radial_count();
+
+   // Per-radial moment metadata
+   const auto numberOfDataMomentGates =
+      radarData.number_of_data_moment_gates(dataBlockType);
+   const auto dataMomentRanges =
+      radarData.data_moment_range_raw(dataBlockType);
+   const auto dataMomentIntervals =
+      radarData.data_moment_range_sample_interval_raw(dataBlockType);
+   const std::uint8_t  dataWordSize = radarData.data_word_size(dataBlockType);
+   const std::size_t   gateStride   = radarData.gate_stride(dataBlockType);
+   const std::uint32_t gates        = numberOfDataMomentGates[0];
+
+   const auto dataMomentsMatrix8  = radarData.data_moments8(dataBlockType);
+   const auto dataMomentsMatrix16 = radarData.data_moments16(dataBlockType);
+   const auto cfpMomentsMatrix =
+      radarData.data_moments8(wsr88d::rda::DataBlockType::MomentCfp);
+   const std::size_t cfpGateStride =
+      radarData.gate_stride(wsr88d::rda::DataBlockType::MomentCfp);
+
+   RadialSweep::Parameters parameters;
+   parameters.coordinates_  = coordinates;
+   parameters.latitude_     = radarData.latitude();
+   parameters.longitude_    = radarData.longitude();
+   parameters.dataWordSize_ = dataWordSize;
+   parameters.cfpEnabled_ =
+      (dataBlockType == wsr88d::rda::DataBlockType::MomentRef &&
+       radarData.has_moment(wsr88d::rda::DataBlockType::MomentCfp));
+
    // Compute threshold at which to display an individual bin (minimum of 2)
-   const uint16_t snrThreshold =
-      std::max<int16_t>(2, momentData0->snr_threshold_raw());
+   parameters.snrThreshold_ = std::max<int16_t>(
+      2, radarData.snr_threshold_raw(dataBlockType));
+
+   // Expanded vertices are only built for renderers without mesh support
+   parameters.expandVertices_ = expandVertices;
+
+   // Compute gate size (number of base 250m gates per bin)
+   const uint16_t gateSizeMeters =
+      static_cast<uint16_t>(radarProductManager->gate_size());
 
    // Start radial is always 0, as coordinates are calculated for each sweep
-   constexpr std::uint16_t startRadial = 0u;
+   std::vector<RadialSweep::Radial> sweepRadials(radials);
 
-   for (auto& radialPair : *radarData)
+   for (uint16_t radial = 0; radial < radials; ++radial)
    {
-      uint16_t radial     = radialPair.first;
-      auto     radialData = radialPair.second;
-      auto     momentData = radialData->moment_data_block(p->dataBlockType_);
+      RadialSweep::Radial& sweepRadial = sweepRadials[radial];
+      sweepRadial.coordinateRadial_    = radial;
 
-      if (momentData0->data_word_size() != momentData->data_word_size())
+      // Radials with a different word size than the first radial are packed
+      // without gates
+      if (numberOfDataMomentGates[radial] == 0)
       {
-         logger_->warn("Radial {} has different word size", radial);
          continue;
       }
 
       // Compute gate interval
-      const uint16_t dataMomentRange = momentData->data_moment_range_raw();
-      const uint16_t dataMomentInterval =
-         momentData->data_moment_range_sample_interval_raw();
+      const uint16_t dataMomentRange     = dataMomentRanges[radial];
+      const uint16_t dataMomentInterval  = dataMomentIntervals[radial];
       const uint16_t dataMomentIntervalH = dataMomentInterval / 2;
 
-      // Compute gate size (number of base 250m gates per bin)
-      const uint16_t gateSizeMeters =
-         static_cast<uint16_t>(radarProductManager->gate_size());
       const uint16_t gateSize =
          std::max<uint16_t>(1, dataMomentInterval / gateSizeMeters);
 
       // Compute gate range [startGate, endGate)
       const uint16_t startGate =
          (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
-      const uint16_t numberOfDataMomentGates =
-         std::min<uint16_t>(momentData->number_of_data_moment_gates(),
-                            static_cast<uint16_t>(gates));
+      const uint16_t numberOfGates = std::min<uint16_t>(
+         numberOfDataMomentGates[radial], static_cast<uint16_t>(gates));
       const uint16_t endGate =
-         std::min<uint16_t>(startGate + numberOfDataMomentGates * gateSize,
+         std::min<uint16_t>(startGate + numberOfGates * gateSize,
                             common::MAX_DATA_MOMENT_GATES);
 
-      const uint8_t*  dataMomentsArray8  = nullptr;
-      const uint16_t* dataMomentsArray16 = nullptr;
-      const uint8_t*  cfpMomentsArray    = nullptr;
+      sweepRadial.startGate_ = startGate;
+      sweepRadial.gateSize_  = gateSize;
+      sweepRadial.binCount_ =
+         (endGate >= startGate) ? (endGate - startGate) / gateSize : 0;
 
-      if (momentData->data_word_size() == 8)
+      if (dataWordSize == 8)
       {
-         dataMomentsArray8 =
-            reinterpret_cast<const uint8_t*>(momentData->data_moments());
+         sweepRadial.dataMoments8_ =
+            dataMomentsMatrix8.data() + radial * gateStride;
       }
       else
       {
-         dataMomentsArray16 =
-            reinterpret_cast<const uint16_t*>(momentData->data_moments());
+         sweepRadial.dataMoments16_ =
+            dataMomentsMatrix16.data() + radial * gateStride;
       }
 
-      if (cfpMoments.size() > 0)
+      if (parameters.cfpEnabled_ && cfpGateStride >= numberOfGates)
       {
-         cfpMomentsArray = reinterpret_cast<const uint8_t*>(
-            radialData->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp)
-               ->data_moments());
-      }
-
-      for (uint16_t gate = startGate, i = 0; gate + gateSize <= endGate;
-           gate += gateSize, ++i)
-      {
-         size_t vertexCount = (gate > 0) ? 6 : 3;
-
-         // Store data moment value
-         if (dataMomentsArray8 != nullptr)
-         {
-            uint8_t dataValue = dataMomentsArray8[i];
-            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-            {
-               continue;
-            }
-
-            for (size_t m = 0; m < vertexCount; m++)
-            {
-               dataMoments8[mIndex++] = dataMomentsArray8[i];
-
-               if (cfpMomentsArray != nullptr)
-               {
-                  cfpMoments[mIndex - 1] = cfpMomentsArray[i];
-               }
-            }
-         }
-         else
-         {
-            uint16_t dataValue = dataMomentsArray16[i];
-            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-            {
-               continue;
-            }
-
-            for (size_t m = 0; m < vertexCount; m++)
-            {
-               dataMoments16[mIndex++] = dataMomentsArray16[i];
-            }
-         }
-
-         // Store vertices
-         if (gate > 0)
-         {
-            const uint16_t baseCoord = gate - 1;
-
-            size_t offset1 = ((startRadial + radial) % radials *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset2 = offset1 + gateSize * 2;
-            size_t offset3 = (((startRadial + radial + 1) % radials) *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset4 = offset3 + gateSize * 2;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertices[vIndex++] = coordinates[offset3];
-            vertices[vIndex++] = coordinates[offset3 + 1];
-
-            vertices[vIndex++] = coordinates[offset3];
-            vertices[vIndex++] = coordinates[offset3 + 1];
-
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertexCount = 6;
-         }
-         else
-         {
-            const uint16_t baseCoord = gate;
-
-            size_t offset1 = ((startRadial + radial) % radials *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset2 = (((startRadial + radial + 1) % radials) *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-
-            vertices[vIndex++] = p->latitude_;
-            vertices[vIndex++] = p->longitude_;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertexCount = 3;
-         }
+         sweepRadial.cfpMoments_ =
+            cfpMomentsMatrix.data() + radial * cfpGateStride;
       }
    }
-   vertices.resize(vIndex);
-   vertices.shrink_to_fit();
 
-   if (momentData0->data_word_size() == 8)
-   {
-      dataMoments8.resize(mIndex);
-      dataMoments8.shrink_to_fit();
-   }
-   else
+   sweep.Build(sweepRadials, parameters, parallel);
+}
+
+bool Level2ProductViewImpl::HasRequiredVertices(const RadialSweep& sweep,
+                                                bool expandVertices)
+{
+   // Sweeps built without expanded vertices cannot be drawn by renderers
+   // without mesh support
+   return !expandVertices || sweep.mesh_.empty() || !sweep.vertices_.empty();
+}
+
+std::size_t Level2ProductViewImpl::PackedMemoryUsage(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   wsr88d::rda::DataBlockType              dataBlockType)
+{
+   // Moment matrices read by BuildSweep are retained with the scan
+   std::size_t memoryUsage = radarData.packed_size(dataBlockType);
+
+   if (dataBlockType == wsr88d::rda::DataBlockType::MomentRef)
    {
-      dataMoments16.resize(mIndex);
-      dataMoments16.shrink_to_fit();
+      memoryUsage +=
+         radarData.packed_size(wsr88d::rda::DataBlockType::MomentCfp);
    }
 
-   if (cfpMoments.size() > 0)
+   return memoryUsage;
+}
+
+std::shared_ptr<const std::vector<float>>
+Level2ProductViewImpl::ComputeCoordinates(
+   const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+   const wsr88d::rda::PackedElevationScan&              radarData,
+   wsr88d::rda::DataBlockType                           dataBlockType)
+{
+   logger_->debug("ComputeCoordinates()");
+
+   boost::timer::cpu_timer timer;
+
+   auto        radarSite = radarProductManager->radar_site();
+   const float gateSize  = radarProductManager->gate_size();
+
+   timer.start();
+
+   const auto numberOfDataMomentGates =
+      radarData.number_of_data_moment_gates(dataBlockType);
+   const std::uint16_t gates0 =
+      numberOfDataMomentGates.empty() ? 0u : numberOfDataMomentGates[0];
+
+   const std::uint16_t numRangeBins =
+      std::max(gates0 + 1u, common::MAX_DATA_MOMENT_GATES);
+
+   // Coordinate grids are shared between views and sweeps with the same site,
+   // gate size and radial azimuths, such that only new azimuth layouts require
+   // calculation
+   auto coordinates = util::PolarCoordinateCache::Instance().GetCoordinates(
+      util::PolarCoordinateCache::CreateKey(radarSite->latitude(),
+                                            radarSite->longitude(),
+                                            gateSize,
+                                            numRangeBins,
+                                            radarData.azimuth_angles()));
+
+   timer.stop();
+   logger_->debug("Coordinates retrieved in {}", timer.format(6, "%ws"));
+
+   return coordinates;
+}
+
+std::shared_ptr<RadialSweep> Level2ProductViewImpl::FindPrecomputedSweep(
+   const std::shared_ptr<wsr88d::rda::PackedElevationScan>& radarData)
+{
+   std::unique_lock lock {precomputeMutex_};
+
+   auto it = precomputedSweeps_.find(radarData);
+   if (it != precomputedSweeps_.cend())
    {
-      cfpMoments.resize(mIndex);
-      cfpMoments.shrink_to_fit();
+      return it->second;
    }
 
-   timer.stop();
-   logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+   return nullptr;
+}
 
-   UpdateColorTable();
+void Level2ProductViewImpl::SchedulePrecompute(
+   std::shared_ptr<manager::RadarProductManager> radarProductManager,
+   std::shared_ptr<wsr88d::Ar2vFile>             level2File,
+   wsr88d::rda::DataBlockType                    dataBlockType,
+   std::chrono::system_clock::time_point         time)
+{
+   auto& generalSettings = manager::SettingsManager::general_settings();
 
-   Q_EMIT SweepComputed();
+   // Supersede any precomputation in progress
+   const std::uint64_t generation = ++precomputeGeneration_;
+
+   if (!generalSettings.precompute_sweeps_enabled().GetValue())
+   {
+      std::unique_lock lock {precomputeMutex_};
+      precomputedSweeps_.clear();
+      return;
+   }
+
+   const std::size_t memoryLimit =
+      static_cast<std::size_t>(
+         generalSettings.precompute_sweeps_memory_limit().GetValue()) *
+      1024u * 1024u;
+
+   boost::asio::post(
+      precomputeThreadPool_,
+      [this,
+       generation,
+       radarProductManager,
+       level2File,
+       dataBlockType,
+       time,
+       memoryLimit,
+       expandVertices = self_->expand_vertices(),
+       elevation      = elevationCut_,
+       elevationCuts  = elevationCuts_,
+       currentScan    = elevationScan_,
+       currentSweep   = sweep_]()
+      {
+         PrecomputeSweeps(generation,
+                          radarProductManager,
+                          level2File,
+                          dataBlockType,
+                          time,
+                          memoryLimit,
+                          expandVertices,
+                          elevation,
+                          elevationCuts,
+                          {currentScan, currentSweep});
+      });
 }
 
-void Level2ProductViewImpl::ComputeCoordinates(
-   std::shared_ptr<wsr88d::rda::ElevationScan> radarData)
+void Level2ProductViewImpl::PrecomputeSweeps(
+   std::uint64_t                                 generation,
+   std::shared_ptr<manager::RadarProductManager> radarProductManager,
+   std::shared_ptr<wsr88d::Ar2vFile>             level2File,
+   wsr88d::rda::DataBlockType                    dataBlockType,
+   std::chrono::system_clock::time_point         time,
+   std::size_t                                   memoryLimit,
+   bool                                          expandVertices,
+   float                                         elevation,
+   std::vector<float>                            elevationCuts,
+   PrecomputedSweepMap::value_type               currentSweep)
 {
-   logger_->debug("ComputeCoordinates()");
+   logger_->debug("PrecomputeSweeps()");
 
    boost::timer::cpu_timer timer;
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
+   // Sweeps from a previous precomputation are reused
+   PrecomputedSweepMap previousSweeps;
+   {
+      std::unique_lock lock {precomputeMutex_};
+      previousSweeps = precomputedSweeps_;
+   }
 
-   auto         radarProductManager = self_->radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const float  gateSize            = radarProductManager->gate_size();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
+   // Precompute the cuts nearest the selected elevation first, such that they
+   // are retained when the memory limit is reached
+   std::stable_sort(elevationCuts.begin(),
+                    elevationCuts.end(),
+                    [elevation](float a, float b)
+                    {
+                       return std::abs(a - elevation) <
+                              std::abs(b - elevation);
+                    });
+
+   // The current sweep is already in memory, and is always retained
+   PrecomputedSweepMap sweeps {currentSweep};
+   std::size_t         memoryUsage =
+      PackedMemoryUsage(*currentSweep.first, dataBlockType) +
+      currentSweep.second->memory_usage();
+   std::size_t         sweepsBuilt = 0;
+
+   for (float elevationCut : elevationCuts)
+   {
+      if (generation != precomputeGeneration_)
+      {
+         logger_->debug("Precomputation superseded");
+         return;
+      }
 
-   // Calculate azimuth coordinates
-   timer.start();
+      // Cuts are selected from the file of the current sweep, without
+      // returning to the radar product manager for each cut
+      std::shared_ptr<wsr88d::rda::PackedElevationScan> radarData =
+         std::get<0>(level2File->GetPackedElevationScan(
+            dataBlockType, elevationCut, time));
 
-   auto& radarData0  = (*radarData)[0];
-   auto  momentData0 = radarData0->moment_data_block(dataBlockType_);
+      if (radarData == nullptr || sweeps.contains(radarData) ||
+          !radarData->has_moment(dataBlockType))
+      {
+         continue;
+      }
 
-   const std::uint16_t numRadials =
-      static_cast<std::uint16_t>(radarData->size());
-   const std::uint16_t numRangeBins =
-      std::max(momentData0->number_of_data_moment_gates() + 1u,
-               common::MAX_DATA_MOMENT_GATES);
+      // Precomputed sweeps retain their scan, including its moment data.
+      // Stop before building a sweep beyond the limit.
+      const std::size_t packedMemory =
+         PackedMemoryUsage(*radarData, dataBlockType);
 
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
+      if (memoryUsage + packedMemory > memoryLimit)
+      {
+         logger_->debug("Precomputed sweep memory limit reached");
+         break;
+      }
+
+      std::shared_ptr<RadialSweep> sweep;
 
-   std::for_each(
-      std::execution::par_unseq,
-      radials.begin(),
-      radials.end(),
-      [&](std::uint32_t radial)
+      auto it = previousSweeps.find(radarData);
+      if (it != previousSweeps.cend() &&
+          HasRequiredVertices(*it->second, expandVertices))
       {
-         // Angles are ordered clockwise, delta should be positive. Only correct
-         // less than -90 degrees, this should cover any "overlap" scenarios.
-         float deltaAngle =
-            (radial == 0) ? (*radarData)[0]->azimuth_angle() -
-                               (*radarData)[numRadials - 1]->azimuth_angle() :
-                            (*radarData)[radial]->azimuth_angle() -
-                               (*radarData)[radial - 1]->azimuth_angle();
-         while (deltaAngle < -90.0f)
-         {
-            deltaAngle += 360.0f;
-         }
-
-         const float angle =
-            (*radarData)[radial]->azimuth_angle() - (deltaAngle * 0.5f);
-
-         std::for_each(std::execution::par_unseq,
-                       gates.begin(),
-                       gates.end(),
-                       [&](std::uint32_t gate)
-                       {
-                          const std::uint32_t radialGate =
-                             radial * common::MAX_DATA_MOMENT_GATES + gate;
-                          const float       range  = (gate + 1) * gateSize;
-                          const std::size_t offset = radialGate * 2;
-
-                          double latitude;
-                          double longitude;
-
-                          geodesic.Direct(radarLatitude,
-                                          radarLongitude,
-                                          angle,
-                                          range,
-                                          latitude,
-                                          longitude);
-
-                          coordinates_[offset]     = latitude;
-                          coordinates_[offset + 1] = longitude;
-                       });
-      });
-   timer.stop();
-   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+         sweep = it->second;
+      }
+      else
+      {
+         // Build serially, leaving the remaining cores to the selected sweep
+         sweep = std::make_shared<RadialSweep>();
+         BuildSweep(radarProductManager,
+                    *radarData,
+                    dataBlockType,
+                    ComputeCoordinates(
+                       radarProductManager, *radarData, dataBlockType),
+                    *sweep,
+                    expandVertices,
+                    false);
+         ++sweepsBuilt;
+      }
+
+      if (memoryUsage + packedMemory + sweep->memory_usage() > memoryLimit)
+      {
+         logger_->debug("Precomputed sweep memory limit reached");
+         break;
+      }
+
+      memoryUsage += packedMemory + sweep->memory_usage();
+      sweeps.emplace(radarData, sweep);
+   }
+
+   std::unique_lock lock {precomputeMutex_};
+
+   if (generation == precomputeGeneration_)
+   {
+      precomputedSweeps_.swap(sweeps);
+
+      timer.stop();
+      logger_->debug("{} sweeps precomputed ({} built, {} bytes) in {}",
+                     precomputedSweeps_.size(),
+                     sweepsBuilt,
+                     memoryUsage,
+                     timer.format(6, "%ws"));
+   }
 }
 
 std::shared_ptr<Level2ProductView> Level2ProductView::Create(
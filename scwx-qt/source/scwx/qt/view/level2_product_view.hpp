@@ -35,6 +35,7 @@ public:
    std::chrono::system_clock::time_point sweep_time() const override;
    std::uint16_t                         vcp() const override;
    const std::vector<float>&             vertices() const override;
+   const RadarMesh*                      mesh() const override;
 
    void LoadColorTable(std::shared_ptr<common::ColorTable> colorTable) override;
    void SelectElevation(float elevation) override;
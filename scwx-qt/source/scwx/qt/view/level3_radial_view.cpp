@@ -1,5 +1,6 @@
 #include <scwx/qt/view/level3_radial_view.hpp>
-#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/radial_projector.hpp>
+#include <scwx/qt/view/radial_sweep.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
@@ -7,6 +8,9 @@
 #include <scwx/wsr88d/rpg/digital_radial_data_array_packet.hpp>
 #include <scwx/wsr88d/rpg/radial_data_packet.hpp>
 
+#include <algorithm>
+#include <span>
+
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 
@@ -24,10 +28,6 @@ static constexpr std::uint32_t kMaxRadialGates_ =
    common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
 static constexpr std::uint32_t kMaxCoordinates_ = kMaxRadialGates_ * 2u;
 
-static constexpr std::uint16_t RANGE_FOLDED      = 1u;
-static constexpr std::uint32_t VERTICES_PER_BIN  = 6u;
-static constexpr std::uint32_t VALUES_PER_VERTEX = 2u;
-
 class Level3RadialViewImpl
 {
 public:
@@ -39,18 +39,19 @@ public:
        vcp_ {},
        sweepTime_ {}
    {
-      coordinates_.resize(kMaxCoordinates_);
    }
    ~Level3RadialViewImpl() = default;
 
-   void ComputeCoordinates(
-      std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket> radialData);
+   void ComputeCoordinates(std::span<const float> startAngles,
+                           std::span<const float> deltaAngles,
+                           std::uint16_t          numRangeBins);
 
    Level3RadialView* self_;
 
-   std::vector<float>        coordinates_ {};
-   std::vector<float>        vertices_ {};
-   std::vector<std::uint8_t> dataMoments8_ {};
+   std::shared_ptr<std::vector<float>> coordinates_ {};
+
+   RadialSweep sweep_ {};
+   bool        sweepExpandVertices_ {false};
 
    float         latitude_;
    float         longitude_;
@@ -90,7 +91,12 @@ uint16_t Level3RadialView::vcp() const
 
 const std::vector<float>& Level3RadialView::vertices() const
 {
-   return p->vertices_;
+   return p->sweep_.vertices_;
+}
+
+const RadarMesh* Level3RadialView::mesh() const
+{
+   return &p->sweep_.mesh_;
 }
 
 std::tuple<const void*, size_t, size_t> Level3RadialView::GetMomentData() const
@@ -99,8 +105,8 @@ std::tuple<const void*, size_t, size_t> Level3RadialView::GetMomentData() const
    size_t      dataSize;
    size_t      componentSize;
 
-   data          = p->dataMoments8_.data();
-   dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+   data          = p->sweep_.dataMoments8_.data();
+   dataSize      = p->sweep_.dataMoments8_.size() * sizeof(uint8_t);
    componentSize = 1;
 
    return std::tie(data, dataSize, componentSize);
@@ -146,7 +152,8 @@ void Level3RadialView::ComputeSweep()
       Q_EMIT SweepNotComputed(types::NoUpdateReason::InvalidData);
       return;
    }
-   else if (gpm == graphic_product_message())
+   else if (gpm == graphic_product_message() &&
+            p->sweepExpandVertices_ == expand_vertices())
    {
       // Skip if this is the message we previously processed
       Q_EMIT SweepNotComputed(types::NoUpdateReason::NoChange);
@@ -179,47 +186,30 @@ void Level3RadialView::ComputeSweep()
    // A message with radial data should either have a Digital Radial Data
    // Array Packet, or a Radial Data Array Packet
    std::shared_ptr<wsr88d::rpg::DigitalRadialDataArrayPacket>
-                                                  digitalDataPacket = nullptr;
-   std::shared_ptr<wsr88d::rpg::RadialDataPacket> radialDataPacket  = nullptr;
+      digitalDataPacket = symbologyBlock->digital_radial_data_array_packet();
+   std::shared_ptr<wsr88d::rpg::RadialDataPacket> radialDataPacket =
+      symbologyBlock->radial_data_packet();
    std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket> radialData = nullptr;
 
-   for (uint16_t layer = 0; layer < numberOfLayers; layer++)
-   {
-      std::vector<std::shared_ptr<wsr88d::rpg::Packet>> packetList =
-         symbologyBlock->packet_list(layer);
-
-      for (auto it = packetList.begin(); it != packetList.end(); it++)
-      {
-         // Prefer Digital Radial Data to Radial Data
-         digitalDataPacket = std::dynamic_pointer_cast<
-            wsr88d::rpg::DigitalRadialDataArrayPacket>(*it);
-
-         if (digitalDataPacket != nullptr)
-         {
-            break;
-         }
-
-         // Otherwise, check for Radial Data
-         if (radialDataPacket == nullptr)
-         {
-            radialDataPacket =
-               std::dynamic_pointer_cast<wsr88d::rpg::RadialDataPacket>(*it);
-         }
-      }
-
-      if (digitalDataPacket != nullptr)
-      {
-         break;
-      }
-   }
+   // Radial angles and levels, retrieved once as contiguous arrays
+   std::span<const float>        startAngles;
+   std::span<const float>        deltaAngles;
+   std::span<const std::uint8_t> levels;
 
+   // Prefer Digital Radial Data to Radial Data
    if (digitalDataPacket != nullptr)
    {
-      radialData = digitalDataPacket;
+      radialData  = digitalDataPacket;
+      startAngles = digitalDataPacket->start_angles();
+      deltaAngles = digitalDataPacket->delta_angles();
+      levels      = digitalDataPacket->levels();
    }
    else if (radialDataPacket != nullptr)
    {
-      radialData = radialDataPacket;
+      radialData  = radialDataPacket;
+      startAngles = radialDataPacket->start_angles();
+      deltaAngles = radialDataPacket->delta_angles();
+      levels      = radialDataPacket->levels();
    }
    else
    {
@@ -251,11 +241,6 @@ void Level3RadialView::ComputeSweep()
       radialSize = common::RadialSize::NonStandard;
    }
 
-   const std::vector<float>& coordinates =
-      (radialSize == common::RadialSize::NonStandard) ?
-         p->coordinates_ :
-         radarProductManager->coordinates(radialSize);
-
    // There should be a positive number of range bins in radial data
    const uint16_t gates = radialData->number_of_range_bins();
    if (gates < 1)
@@ -276,138 +261,73 @@ void Level3RadialView::ComputeSweep()
    // Calculate vertices
    timer.start();
 
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(radials * gates * VERTICES_PER_BIN * VALUES_PER_VERTEX);
-
-   // Setup data moment vector
-   std::vector<uint8_t>& dataMoments8 = p->dataMoments8_;
-   size_t                mIndex       = 0;
-
-   dataMoments8.resize(radials * gates * VERTICES_PER_BIN);
-
-   // Compute threshold at which to display an individual bin
-   const uint16_t snrThreshold = descriptionBlock->threshold();
-
    // Determine which radial to start at
    std::uint16_t startRadial;
    if (radialSize == common::RadialSize::NonStandard)
    {
-      p->ComputeCoordinates(radialData);
+      p->ComputeCoordinates(startAngles, deltaAngles, gates);
       startRadial = 0;
    }
    else
    {
       const float radialMultiplier = radials / 360.0f;
-      const float startAngle       = radialData->start_angle(0);
+      const float startAngle       = startAngles[0];
       startRadial = std::lroundf(startAngle * radialMultiplier);
    }
 
-   for (uint16_t radial = 0; radial < radialData->number_of_radials(); radial++)
+   RadialSweep::Parameters parameters;
+   parameters.latitude_  = p->latitude_;
+   parameters.longitude_ = p->longitude_;
+
+   // Compute threshold at which to display an individual bin
+   parameters.snrThreshold_ = descriptionBlock->threshold();
+
+   // Expanded vertices are only built for renderers without mesh support
+   parameters.expandVertices_ = expand_vertices();
+   p->sweepExpandVertices_    = parameters.expandVertices_;
+
+   // Coordinates are shared with the indexed mesh. Standard coordinates are
+   // owned by the Radar Product Manager.
+   if (radialSize == common::RadialSize::NonStandard)
    {
-      const auto dataMomentsArray8 = radialData->level(radial);
-
-      // Compute gate interval
-      const uint16_t dataMomentInterval = descriptionBlock->x_resolution_raw();
-
-      // Compute gate size (number of base gates per bin)
-      const uint16_t gateSize = std::max<uint16_t>(
-         1,
-         dataMomentInterval /
-            static_cast<uint16_t>(radarProductManager->gate_size()));
-
-      // Compute gate range [startGate, endGate)
-      const uint16_t startGate = 0;
-      const uint16_t endGate   = std::min<uint16_t>(
-         startGate + gates * gateSize, common::MAX_DATA_MOMENT_GATES);
-
-      for (uint16_t gate = startGate, i = 0; gate + gateSize <= endGate;
-           gate += gateSize, ++i)
-      {
-         size_t vertexCount = (gate > 0) ? 6 : 3;
-
-         // Store data moment value
-         uint8_t dataValue =
-            (i < dataMomentsArray8.size()) ? dataMomentsArray8[i] : 0;
-         if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-         {
-            continue;
-         }
-
-         for (size_t m = 0; m < vertexCount; m++)
-         {
-            dataMoments8[mIndex++] = dataValue;
-         }
-
-         // Store vertices
-         if (gate > 0)
-         {
-            const uint16_t baseCoord = gate - 1;
-
-            size_t offset1 = ((startRadial + radial) % radials *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset2 = offset1 + gateSize * 2;
-            size_t offset3 = (((startRadial + radial + 1) % radials) *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset4 = offset3 + gateSize * 2;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertices[vIndex++] = coordinates[offset3];
-            vertices[vIndex++] = coordinates[offset3 + 1];
-
-            vertices[vIndex++] = coordinates[offset3];
-            vertices[vIndex++] = coordinates[offset3 + 1];
-
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertexCount = 6;
-         }
-         else
-         {
-            const uint16_t baseCoord = gate;
-
-            size_t offset1 = ((startRadial + radial) % radials *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset2 = (((startRadial + radial + 1) % radials) *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-
-            vertices[vIndex++] = p->latitude_;
-            vertices[vIndex++] = p->longitude_;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertexCount = 3;
-         }
-      }
+      parameters.coordinates_ = p->coordinates_;
    }
-   vertices.resize(vIndex);
-   vertices.shrink_to_fit();
+   else
+   {
+      parameters.coordinates_ = std::shared_ptr<const std::vector<float>>(
+         radarProductManager, &radarProductManager->coordinates(radialSize));
+   }
+
+   // Compute gate interval
+   const uint16_t dataMomentInterval = descriptionBlock->x_resolution_raw();
+
+   // Compute gate size (number of base gates per bin)
+   const std::uint16_t gateSize = std::max<uint16_t>(
+      1,
+      dataMomentInterval /
+         static_cast<uint16_t>(radarProductManager->gate_size()));
+
+   // Compute the number of bins in each radial which fit within the maximum
+   // number of data moment gates
+   const std::uint16_t binCount = static_cast<std::uint16_t>(
+      std::min<std::size_t>(gates, common::MAX_DATA_MOMENT_GATES / gateSize));
+
+   std::vector<RadialSweep::Radial> sweepRadials(radials);
+
+   for (std::size_t radial = 0; radial < radials; ++radial)
+   {
+      RadialSweep::Radial& sweepRadial = sweepRadials[radial];
 
-   dataMoments8.resize(mIndex);
-   dataMoments8.shrink_to_fit();
+      sweepRadial.coordinateRadial_ =
+         static_cast<std::uint16_t>((startRadial + radial) % radials);
+      sweepRadial.gateSize_ = gateSize;
+      sweepRadial.binCount_ = binCount;
+
+      // Each radial is a row of the level matrix
+      sweepRadial.dataMoments8_ = levels.data() + radial * gates;
+   }
+
+   p->sweep_.Build(sweepRadials, parameters);
 
    timer.stop();
    logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
@@ -418,29 +338,39 @@ void Level3RadialView::ComputeSweep()
 }
 
 void Level3RadialViewImpl::ComputeCoordinates(
-   std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket> radialData)
+   std::span<const float> startAngles,
+   std::span<const float> deltaAngles,
+   std::uint16_t          numRangeBins)
 {
    logger_->debug("ComputeCoordinates()");
 
    boost::timer::cpu_timer timer;
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
-
-   auto         radarProductManager = self_->radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const float  gateSize            = radarProductManager->gate_size();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
+   auto        radarProductManager = self_->radar_product_manager();
+   auto        radarSite           = radarProductManager->radar_site();
+   const float gateSize            = radarProductManager->gate_size();
 
    // Calculate azimuth coordinates
    timer.start();
 
-   const std::uint16_t numRadials   = radialData->number_of_radials();
-   const std::uint16_t numRangeBins = radialData->number_of_range_bins();
+   const std::uint16_t numRadials =
+      static_cast<std::uint16_t>(startAngles.size());
+
+   // Coordinates may still be referenced by a mesh previously uploaded by a
+   // layer, in which case they cannot be modified
+   sweep_.mesh_.coordinates_.reset();
+   if (coordinates_ == nullptr || coordinates_.use_count() > 1)
+   {
+      coordinates_ = std::make_shared<std::vector<float>>(kMaxCoordinates_);
+   }
+
+   const std::size_t numGates = std::min<std::size_t>(
+      numRangeBins, common::MAX_DATA_MOMENT_GATES);
+
+   const util::RadialProjector projector {
+      radarSite->latitude(), radarSite->longitude(), numGates * gateSize};
 
    auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
 
    std::for_each(std::execution::par_unseq,
                  radials.begin(),
@@ -451,8 +381,8 @@ void Level3RadialViewImpl::ComputeCoordinates(
                     if (radial == 0)
                     {
                        // Angles are ordered clockwise, delta should be positive
-                       deltaAngle = radialData->start_angle(0) -
-                                    radialData->start_angle(numRadials - 1);
+                       deltaAngle =
+                          startAngles[0] - startAngles[numRadials - 1];
                        while (deltaAngle < 0.0f)
                        {
                           deltaAngle += 360.0f;
@@ -460,36 +390,19 @@ void Level3RadialViewImpl::ComputeCoordinates(
                     }
                     else
                     {
-                       deltaAngle = radialData->delta_angle(radial);
+                       deltaAngle = deltaAngles[radial];
                     }
 
                     const float angle =
-                       radialData->start_angle(radial) - (deltaAngle * 0.5f);
-
-                    std::for_each(std::execution::par_unseq,
-                                  gates.begin(),
-                                  gates.end(),
-                                  [&](std::uint32_t gate)
-                                  {
-                                     const std::uint32_t radialGate =
-                                        radial * common::MAX_DATA_MOMENT_GATES +
-                                        gate;
-                                     const float range = (gate + 1) * gateSize;
-                                     const std::size_t offset = radialGate * 2;
-
-                                     double latitude;
-                                     double longitude;
-
-                                     geodesic.Direct(radarLatitude,
-                                                     radarLongitude,
-                                                     angle,
-                                                     range,
-                                                     latitude,
-                                                     longitude);
-
-                                     coordinates_[offset]     = latitude;
-                                     coordinates_[offset + 1] = longitude;
-                                  });
+                       startAngles[radial] - (deltaAngle * 0.5f);
+
+                    projector.Project(
+                       angle,
+                       gateSize,
+                       gateSize,
+                       std::span<float> {*coordinates_}.subspan(
+                          radial * common::MAX_DATA_MOMENT_GATES * 2,
+                          numGates * 2));
                  });
    timer.stop();
    logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
@@ -29,6 +29,7 @@ public:
    std::chrono::system_clock::time_point sweep_time() const override;
    std::uint16_t                         vcp() const override;
    const std::vector<float>&             vertices() const override;
+   const RadarMesh*                      mesh() const override;
 
    std::tuple<const void*, std::size_t, std::size_t>
    GetMomentData() const override;
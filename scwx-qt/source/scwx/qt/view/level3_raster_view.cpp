@@ -1,12 +1,11 @@
 #include <scwx/qt/view/level3_raster_view.hpp>
-#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/raster_coordinate_cache.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/rpg/raster_data_packet.hpp>
 
-#include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 
 namespace scwx
@@ -160,29 +159,8 @@ void Level3RasterView::ComputeSweep()
    }
 
    // A message with raster data should have a Raster Data Packet
-   std::shared_ptr<wsr88d::rpg::RasterDataPacket> rasterData = nullptr;
-
-   for (uint16_t layer = 0; layer < numberOfLayers; layer++)
-   {
-      std::vector<std::shared_ptr<wsr88d::rpg::Packet>> packetList =
-         symbologyBlock->packet_list(layer);
-
-      for (auto it = packetList.begin(); it != packetList.end(); it++)
-      {
-         rasterData =
-            std::dynamic_pointer_cast<wsr88d::rpg::RasterDataPacket>(*it);
-
-         if (rasterData != nullptr)
-         {
-            break;
-         }
-      }
-
-      if (rasterData != nullptr)
-      {
-         break;
-      }
-   }
+   std::shared_ptr<wsr88d::rpg::RasterDataPacket> rasterData =
+      symbologyBlock->raster_data_packet();
 
    if (rasterData == nullptr)
    {
@@ -193,11 +171,7 @@ void Level3RasterView::ComputeSweep()
 
    // Calculate raster grid size
    const uint16_t rows       = rasterData->number_of_rows();
-   size_t         maxColumns = 0;
-   for (uint16_t r = 0; r < rows; r++)
-   {
-      maxColumns = std::max<size_t>(maxColumns, rasterData->level(r).size());
-   }
+   const size_t   maxColumns = rasterData->number_of_columns();
 
    if (maxColumns == 0)
    {
@@ -214,58 +188,22 @@ void Level3RasterView::ComputeSweep()
                             descriptionBlock->volume_scan_start_time() * 1000);
    p->vcp_ = descriptionBlock->volume_coverage_pattern();
 
-   const GeographicLib::Geodesic& geodesic =
-      util::GeographicLib::DefaultGeodesic();
-
-   const uint16_t xResolution = descriptionBlock->x_resolution_raw();
-   const uint16_t yResolution = descriptionBlock->y_resolution_raw();
-   double         iCoordinate =
-      (-rasterData->i_coordinate_start() - 1.0 - p->range_) * 1000.0;
-   double jCoordinate =
-      (rasterData->j_coordinate_start() + 1.0 + p->range_) * 1000.0;
-
-   size_t numCoordinates =
-      static_cast<size_t>(rows + 1) * static_cast<size_t>(maxColumns + 1);
-   auto coordinateRange =
-      boost::irange<uint32_t>(0, static_cast<uint32_t>(numCoordinates));
-
-   std::vector<float> coordinates;
-   coordinates.resize(numCoordinates * 2);
-
-   // Calculate coordinates
-   timer.start();
-
-   std::for_each(
-      std::execution::par_unseq,
-      coordinateRange.begin(),
-      coordinateRange.end(),
-      [&](uint32_t index)
-      {
-         // For each row or column, there is one additional coordinate. Each bin
-         // is bounded by 4 coordinates.
-         const uint32_t col = index % (rows + 1);
-         const uint32_t row = index / (rows + 1);
-
-         const double i = iCoordinate + xResolution * col;
-         const double j = jCoordinate - yResolution * row;
-
-         // Calculate polar coordinates based on i and j
-         const double angle  = std::atan2(i, j) * 180.0 / M_PI;
-         const double range  = std::sqrt(i * i + j * j);
-         const size_t offset = static_cast<size_t>(index) * 2;
-
-         double latitude;
-         double longitude;
-
-         geodesic.Direct(
-            p->latitude_, p->longitude_, angle, range, latitude, longitude);
-
-         coordinates[offset]     = latitude;
-         coordinates[offset + 1] = longitude;
-      });
-
-   timer.stop();
-   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+   // Coordinates depend only on the grid parameters, and are shared between
+   // products at the same site
+   const util::RasterGridKey gridKey {
+      .latitude_    = p->latitude_,
+      .longitude_   = p->longitude_,
+      .range_       = p->range_,
+      .xResolution_ = descriptionBlock->x_resolution_raw(),
+      .yResolution_ = descriptionBlock->y_resolution_raw(),
+      .iStart_      = rasterData->i_coordinate_start(),
+      .jStart_      = rasterData->j_coordinate_start(),
+      .rows_        = rows,
+      .columns_     = static_cast<std::uint16_t>(maxColumns)};
+
+   std::shared_ptr<const std::vector<float>> coordinatesPtr =
+      util::RasterCoordinateCache::Instance().GetCoordinates(gridKey);
+   const std::vector<float>& coordinates = *coordinatesPtr;
 
    // Calculate vertices
    timer.start();
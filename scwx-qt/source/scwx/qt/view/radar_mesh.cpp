@@ -0,0 +1,103 @@
+#include <scwx/qt/view/radar_mesh.hpp>
+#include <scwx/common/constants.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+void RadarMesh::Clear()
+{
+   coordinates_.reset();
+   radials_   = 0;
+   latitude_  = 0.0f;
+   longitude_ = 0.0f;
+
+   gates_.clear();
+   dataMoments8_.clear();
+   dataMoments16_.clear();
+   cfpMoments_.clear();
+}
+
+bool RadarMesh::empty() const
+{
+   return gates_.empty();
+}
+
+std::size_t RadarMesh::gate_count() const
+{
+   return gates_.size();
+}
+
+std::size_t RadarMesh::sweep_data_size() const
+{
+   return gates_.size() * sizeof(std::uint32_t) +
+          dataMoments8_.size() * sizeof(std::uint8_t) +
+          dataMoments16_.size() * sizeof(std::uint16_t) +
+          cfpMoments_.size() * sizeof(std::uint8_t);
+}
+
+std::vector<float> RadarMesh::ExpandVertices() const
+{
+   std::vector<float> vertices {};
+
+   if (coordinates_ == nullptr || radials_ == 0)
+   {
+      return vertices;
+   }
+
+   const std::vector<float>& coordinates = *coordinates_;
+
+   vertices.reserve(gates_.size() * kVerticesPerGate * 2);
+
+   for (std::uint32_t packedGate : gates_)
+   {
+      std::uint32_t radial;
+      std::uint32_t gate;
+      std::uint32_t gateSize;
+
+      UnpackGate(packedGate, radial, gate, gateSize);
+
+      const std::size_t radialOffset1 =
+         static_cast<std::size_t>(radial) * common::MAX_DATA_MOMENT_GATES * 2;
+      const std::size_t radialOffset2 =
+         static_cast<std::size_t>((radial + 1) % radials_) *
+         common::MAX_DATA_MOMENT_GATES * 2;
+
+      if (gate > 0)
+      {
+         const std::size_t baseCoord = (gate - 1) * 2;
+
+         const std::size_t offset1 = radialOffset1 + baseCoord;
+         const std::size_t offset2 = offset1 + gateSize * 2;
+         const std::size_t offset3 = radialOffset2 + baseCoord;
+         const std::size_t offset4 = offset3 + gateSize * 2;
+
+         for (std::size_t offset :
+              {offset1, offset2, offset3, offset3, offset4, offset2})
+         {
+            vertices.push_back(coordinates[offset]);
+            vertices.push_back(coordinates[offset + 1]);
+         }
+      }
+      else
+      {
+         vertices.push_back(latitude_);
+         vertices.push_back(longitude_);
+
+         vertices.push_back(coordinates[radialOffset1]);
+         vertices.push_back(coordinates[radialOffset1 + 1]);
+
+         vertices.push_back(coordinates[radialOffset2]);
+         vertices.push_back(coordinates[radialOffset2 + 1]);
+      }
+   }
+
+   return vertices;
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
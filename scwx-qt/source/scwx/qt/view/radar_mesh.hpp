@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * @brief Indexed representation of a radial sweep.
+ *
+ * The coordinate grid of a site is shared between sweeps, and is indexed by
+ * radial * MAX_DATA_MOMENT_GATES + gate. Each sweep consists only of a packed
+ * reference to each displayed gate, and one data moment per gate. Gates are
+ * drawn as two triangles, or a single triangle for the first gate, identical
+ * to the vertices of a non-indexed sweep.
+ *
+ * Gate references are packed into 32 bits:
+ * - Bits 0-10: Base gate index
+ * - Bits 11-20: Coordinate radial index
+ * - Bits 21-31: Gate size (number of base gates per bin)
+ */
+struct RadarMesh
+{
+   static constexpr std::uint32_t kGateBits     = 11u;
+   static constexpr std::uint32_t kRadialBits   = 10u;
+   static constexpr std::uint32_t kGateSizeBits = 11u;
+
+   static constexpr std::uint32_t kGateMask     = (1u << kGateBits) - 1u;
+   static constexpr std::uint32_t kRadialMask   = (1u << kRadialBits) - 1u;
+   static constexpr std::uint32_t kGateSizeMask = (1u << kGateSizeBits) - 1u;
+
+   static constexpr std::size_t kVerticesPerGate = 6u;
+
+   std::shared_ptr<const std::vector<float>> coordinates_ {};
+
+   std::uint16_t radials_ {0};
+   float         latitude_ {0.0f};
+   float         longitude_ {0.0f};
+
+   std::vector<std::uint32_t> gates_ {};
+   std::vector<std::uint8_t>  dataMoments8_ {};
+   std::vector<std::uint16_t> dataMoments16_ {};
+   std::vector<std::uint8_t>  cfpMoments_ {};
+
+   void        Clear();
+   bool        empty() const;
+   std::size_t gate_count() const;
+
+   /**
+    * Size in bytes of the per-sweep data, excluding the coordinate grid.
+    */
+   std::size_t sweep_data_size() const;
+
+   /**
+    * Expands the mesh into triangle vertices, as latitude/longitude pairs.
+    *
+    * @return Vertices of the non-indexed sweep
+    */
+   std::vector<float> ExpandVertices() const;
+
+   static constexpr std::uint32_t PackGate(std::uint32_t radial,
+                                           std::uint32_t gate,
+                                           std::uint32_t gateSize)
+   {
+      return (gate & kGateMask) |
+             ((radial & kRadialMask) << kGateBits) |
+             ((gateSize & kGateSizeMask) << (kGateBits + kRadialBits));
+   }
+
+   static constexpr void UnpackGate(std::uint32_t  packedGate,
+                                    std::uint32_t& radial,
+                                    std::uint32_t& gate,
+                                    std::uint32_t& gateSize)
+   {
+      gate     = packedGate & kGateMask;
+      radial   = (packedGate >> kGateBits) & kRadialMask;
+      gateSize = (packedGate >> (kGateBits + kRadialBits)) & kGateSizeMask;
+   }
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -2,6 +2,8 @@
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <atomic>
+
 #include <boost/asio.hpp>
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
@@ -30,6 +32,7 @@ public:
    explicit RadarProductViewImpl(
       std::shared_ptr<manager::RadarProductManager> radarProductManager) :
        initialized_ {false},
+       expandVertices_ {false},
        sweepMutex_ {},
        selectedTime_ {},
        radarProductManager_ {radarProductManager}
@@ -39,8 +42,9 @@ public:
 
    boost::asio::thread_pool threadPool_ {1};
 
-   bool       initialized_;
-   std::mutex sweepMutex_;
+   bool              initialized_;
+   std::atomic<bool> expandVertices_;
+   std::mutex        sweepMutex_;
 
    std::chrono::system_clock::time_point selectedTime_;
 
@@ -136,6 +140,25 @@ std::vector<float> RadarProductView::GetElevationCuts() const
    return {};
 }
 
+const RadarMesh* RadarProductView::mesh() const
+{
+   return nullptr;
+}
+
+bool RadarProductView::expand_vertices() const
+{
+   return p->expandVertices_;
+}
+
+void RadarProductView::set_expand_vertices(bool expandVertices)
+{
+   if (p->expandVertices_.exchange(expandVertices) != expandVertices &&
+       p->initialized_)
+   {
+      Update();
+   }
+}
+
 std::tuple<const void*, std::size_t, std::size_t>
 RadarProductView::GetCfpMomentData() const
 {
@@ -4,6 +4,7 @@
 #include <scwx/common/products.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
 #include <scwx/qt/types/map_types.hpp>
+#include <scwx/qt/view/radar_mesh.hpp>
 
 #include <chrono>
 #include <memory>
@@ -39,6 +40,20 @@ public:
    virtual std::uint16_t                         vcp() const      = 0;
    virtual const std::vector<float>&             vertices() const = 0;
 
+   /**
+    * Indexed mesh of the current sweep, or nullptr if the view does not
+    * support indexed rendering.
+    */
+   virtual const RadarMesh* mesh() const;
+
+   /**
+    * Whether views supporting the indexed mesh also build expanded vertices,
+    * for renderers which cannot draw the mesh. Changing the value recomputes
+    * the sweep.
+    */
+   bool expand_vertices() const;
+   void set_expand_vertices(bool expandVertices);
+
    std::shared_ptr<manager::RadarProductManager> radar_product_manager() const;
    std::chrono::system_clock::time_point         selected_time() const;
    std::mutex&                                   sweep_mutex();
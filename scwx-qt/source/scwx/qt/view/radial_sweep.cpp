@@ -0,0 +1,328 @@
+#include <scwx/qt/view/radial_sweep.hpp>
+#include <scwx/common/constants.hpp>
+
+#include <algorithm>
+#include <execution>
+#include <numeric>
+
+#include <boost/range/irange.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static constexpr std::uint16_t RANGE_FOLDED      = 1u;
+static constexpr std::size_t   VALUES_PER_VERTEX = 2u;
+
+template<class T>
+static void BuildSweep(std::span<const RadialSweep::Radial> radials,
+                       const RadialSweep::Parameters&       parameters,
+                       bool                                 parallel,
+                       RadialSweep&                         sweep,
+                       std::vector<T>&                      dataMoments,
+                       std::vector<T>&                      meshDataMoments);
+
+template<class T>
+static std::size_t CapacityBytes(const std::vector<T>& v)
+{
+   return v.capacity() * sizeof(T);
+}
+
+void RadialSweep::Build(std::span<const Radial> radials,
+                        const Parameters&       parameters,
+                        bool                    parallel)
+{
+   if (parameters.dataWordSize_ == 8)
+   {
+      dataMoments16_.clear();
+      dataMoments16_.shrink_to_fit();
+      mesh_.dataMoments16_.clear();
+      mesh_.dataMoments16_.shrink_to_fit();
+
+      BuildSweep(radials,
+                 parameters,
+                 parallel,
+                 *this,
+                 dataMoments8_,
+                 mesh_.dataMoments8_);
+   }
+   else
+   {
+      dataMoments8_.clear();
+      dataMoments8_.shrink_to_fit();
+      mesh_.dataMoments8_.clear();
+      mesh_.dataMoments8_.shrink_to_fit();
+
+      BuildSweep(radials,
+                 parameters,
+                 parallel,
+                 *this,
+                 dataMoments16_,
+                 mesh_.dataMoments16_);
+   }
+}
+
+void RadialSweep::Clear()
+{
+   vertices_.clear();
+   dataMoments8_.clear();
+   dataMoments16_.clear();
+   cfpMoments_.clear();
+   mesh_.Clear();
+}
+
+std::size_t RadialSweep::memory_usage() const
+{
+   return CapacityBytes(vertices_) + CapacityBytes(dataMoments8_) +
+          CapacityBytes(dataMoments16_) + CapacityBytes(cfpMoments_) +
+          CapacityBytes(mesh_.gates_) + CapacityBytes(mesh_.dataMoments8_) +
+          CapacityBytes(mesh_.dataMoments16_) +
+          CapacityBytes(mesh_.cfpMoments_);
+}
+
+template<class F>
+static void ForEachRadial(bool parallel, std::size_t radialCount, F&& f)
+{
+   auto radialIndices = boost::irange<std::size_t>(0u, radialCount);
+
+   if (parallel)
+   {
+      std::for_each(std::execution::par_unseq,
+                    radialIndices.begin(),
+                    radialIndices.end(),
+                    std::forward<F>(f));
+   }
+   else
+   {
+      std::for_each(
+         radialIndices.begin(), radialIndices.end(), std::forward<F>(f));
+   }
+}
+
+template<class T>
+static const T* DataMoments(const RadialSweep::Radial& radial)
+{
+   if constexpr (sizeof(T) == 1)
+   {
+      return radial.dataMoments8_;
+   }
+   else
+   {
+      return radial.dataMoments16_;
+   }
+}
+
+template<class T>
+static void BuildSweep(std::span<const RadialSweep::Radial> radials,
+                       const RadialSweep::Parameters&       parameters,
+                       bool                                 parallel,
+                       RadialSweep&                         sweep,
+                       std::vector<T>&                      dataMoments,
+                       std::vector<T>&                      meshDataMoments)
+{
+   const std::size_t   radialCount  = radials.size();
+   const std::uint16_t snrThreshold = parameters.snrThreshold_;
+   const bool          cfpEnabled   = parameters.cfpEnabled_;
+   const bool          expand       = parameters.expandVertices_;
+
+   // Offsets of each radial, in displayed bins and vertices, where element
+   // r + 1 initially holds the count of radial r
+   std::vector<std::size_t> binOffsets(radialCount + 1, 0u);
+   std::vector<std::size_t> vertexOffsets(radialCount + 1, 0u);
+
+   // Count pass
+   ForEachRadial(
+      parallel,
+      radialCount,
+      [&](std::size_t r)
+      {
+         const RadialSweep::Radial& radial  = radials[r];
+         const T*                   moments = DataMoments<T>(radial);
+
+         std::size_t binCount    = 0;
+         std::size_t vertexCount = 0;
+
+         for (std::size_t i = 0; i < radial.binCount_; ++i)
+         {
+            const T dataValue = moments[i];
+            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+            {
+               continue;
+            }
+
+            const std::size_t gate = radial.startGate_ + i * radial.gateSize_;
+
+            ++binCount;
+            vertexCount += (gate > 0) ? 6 : 3;
+         }
+
+         binOffsets[r + 1]    = binCount;
+         vertexOffsets[r + 1] = vertexCount;
+      });
+
+   std::inclusive_scan(
+      binOffsets.cbegin(), binOffsets.cend(), binOffsets.begin());
+   std::inclusive_scan(
+      vertexOffsets.cbegin(), vertexOffsets.cend(), vertexOffsets.begin());
+
+   const std::size_t totalBins     = binOffsets.back();
+   const std::size_t totalVertices = expand ? vertexOffsets.back() : 0u;
+
+   // Size buffers exactly, each element is written by the fill pass
+   sweep.vertices_.clear();
+   sweep.vertices_.resize(totalVertices * VALUES_PER_VERTEX);
+   sweep.vertices_.shrink_to_fit();
+
+   dataMoments.clear();
+   dataMoments.resize(totalVertices);
+   dataMoments.shrink_to_fit();
+
+   sweep.cfpMoments_.clear();
+   sweep.cfpMoments_.resize((cfpEnabled && expand) ? totalVertices : 0u);
+   sweep.cfpMoments_.shrink_to_fit();
+
+   RadarMesh& mesh = sweep.mesh_;
+
+   mesh.coordinates_ = parameters.coordinates_;
+   mesh.radials_     = static_cast<std::uint16_t>(radialCount);
+   mesh.latitude_    = parameters.latitude_;
+   mesh.longitude_   = parameters.longitude_;
+
+   mesh.gates_.clear();
+   mesh.gates_.resize(totalBins);
+   mesh.gates_.shrink_to_fit();
+
+   meshDataMoments.clear();
+   meshDataMoments.resize(totalBins);
+   meshDataMoments.shrink_to_fit();
+
+   mesh.cfpMoments_.clear();
+   mesh.cfpMoments_.resize(cfpEnabled ? totalBins : 0u);
+   mesh.cfpMoments_.shrink_to_fit();
+
+   if (totalBins == 0 || parameters.coordinates_ == nullptr)
+   {
+      return;
+   }
+
+   const float*  coords     = parameters.coordinates_->data();
+   float*        vertexData = sweep.vertices_.data();
+   T*            momentData = dataMoments.data();
+   std::uint8_t* cfpData    = sweep.cfpMoments_.data();
+   const float   latitude   = parameters.latitude_;
+   const float   longitude  = parameters.longitude_;
+
+   // Fill pass
+   ForEachRadial(
+      parallel,
+      radialCount,
+      [&](std::size_t r)
+      {
+         const RadialSweep::Radial& radial      = radials[r];
+         const T*                   moments     = DataMoments<T>(radial);
+         const std::uint8_t*        cfpMoments  = radial.cfpMoments_;
+         const std::size_t          gateSize    = radial.gateSize_;
+         const std::size_t          coordRadial = radial.coordinateRadial_;
+
+         // Coordinate offsets of the first gate of each radial edge
+         const std::size_t radialOffset1 =
+            coordRadial * common::MAX_DATA_MOMENT_GATES * 2;
+         const std::size_t radialOffset2 = (coordRadial + 1) % radialCount *
+                                           common::MAX_DATA_MOMENT_GATES * 2;
+
+         std::size_t gIndex = binOffsets[r];
+         std::size_t mIndex = vertexOffsets[r];
+         std::size_t vIndex = mIndex * VALUES_PER_VERTEX;
+
+         for (std::size_t i = 0; i < radial.binCount_; ++i)
+         {
+            const T dataValue = moments[i];
+            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+            {
+               continue;
+            }
+
+            const std::size_t  gate     = radial.startGate_ + i * gateSize;
+            const std::uint8_t cfpValue =
+               (cfpMoments != nullptr) ? cfpMoments[i] : 0u;
+
+            // Store indexed mesh gate
+            mesh.gates_[gIndex] = RadarMesh::PackGate(
+               static_cast<std::uint32_t>(coordRadial),
+               static_cast<std::uint32_t>(gate),
+               static_cast<std::uint32_t>(gateSize));
+            meshDataMoments[gIndex] = dataValue;
+            if (cfpEnabled)
+            {
+               mesh.cfpMoments_[gIndex] = cfpValue;
+            }
+            ++gIndex;
+
+            if (!expand)
+            {
+               continue;
+            }
+
+            // Store vertices
+            std::size_t vertexCount;
+
+            if (gate > 0)
+            {
+               const std::size_t baseCoord = (gate - 1) * 2;
+
+               const std::size_t offset1 = radialOffset1 + baseCoord;
+               const std::size_t offset2 = offset1 + gateSize * 2;
+               const std::size_t offset3 = radialOffset2 + baseCoord;
+               const std::size_t offset4 = offset3 + gateSize * 2;
+
+               vertexData[vIndex++] = coords[offset1];
+               vertexData[vIndex++] = coords[offset1 + 1];
+
+               vertexData[vIndex++] = coords[offset2];
+               vertexData[vIndex++] = coords[offset2 + 1];
+
+               vertexData[vIndex++] = coords[offset3];
+               vertexData[vIndex++] = coords[offset3 + 1];
+
+               vertexData[vIndex++] = coords[offset3];
+               vertexData[vIndex++] = coords[offset3 + 1];
+
+               vertexData[vIndex++] = coords[offset4];
+               vertexData[vIndex++] = coords[offset4 + 1];
+
+               vertexData[vIndex++] = coords[offset2];
+               vertexData[vIndex++] = coords[offset2 + 1];
+
+               vertexCount = 6;
+            }
+            else
+            {
+               vertexData[vIndex++] = latitude;
+               vertexData[vIndex++] = longitude;
+
+               vertexData[vIndex++] = coords[radialOffset1];
+               vertexData[vIndex++] = coords[radialOffset1 + 1];
+
+               vertexData[vIndex++] = coords[radialOffset2];
+               vertexData[vIndex++] = coords[radialOffset2 + 1];
+
+               vertexCount = 3;
+            }
+
+            // Store data moment value
+            std::fill_n(momentData + mIndex, vertexCount, dataValue);
+            if (cfpEnabled)
+            {
+               std::fill_n(cfpData + mIndex, vertexCount, cfpValue);
+            }
+            mIndex += vertexCount;
+         }
+      });
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <scwx/qt/view/radar_mesh.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * @brief Render buffers of a radial sweep.
+ *
+ * The indexed mesh contains one gate reference and data moment per displayed
+ * bin. Optionally, each displayed bin is also expanded into two triangles, or
+ * a single triangle for the first gate, with one data moment per vertex, for
+ * renderers which do not support the indexed mesh.
+ *
+ * Buffers are built in two parallel passes. The first pass counts the
+ * displayed bins of each radial, from which the offset of each radial is
+ * calculated. The second pass fills each radial independently, in the same
+ * order as a serial build.
+ */
+struct RadialSweep
+{
+   /**
+    * @brief Bins of a single radial.
+    */
+   struct Radial
+   {
+      /** Radial index in the coordinate grid */
+      std::uint16_t coordinateRadial_ {0};
+
+      /** Base gate index of the first bin */
+      std::uint16_t startGate_ {0};
+
+      /** Number of base gates per bin */
+      std::uint16_t gateSize_ {1};
+
+      /** Number of bins in the radial */
+      std::uint16_t binCount_ {0};
+
+      /** Data moments, 8-bit or 16-bit according to the sweep word size */
+      const std::uint8_t*  dataMoments8_ {nullptr};
+      const std::uint16_t* dataMoments16_ {nullptr};
+
+      /** Clutter filter power removed, optional */
+      const std::uint8_t* cfpMoments_ {nullptr};
+   };
+
+   /**
+    * @brief Parameters common to each radial of a sweep.
+    */
+   struct Parameters
+   {
+      std::shared_ptr<const std::vector<float>> coordinates_ {};
+
+      float         latitude_ {0.0f};
+      float         longitude_ {0.0f};
+      std::uint16_t snrThreshold_ {0};
+      std::uint8_t  dataWordSize_ {8};
+      bool          cfpEnabled_ {false};
+
+      /** Build expanded vertices and moments in addition to the mesh */
+      bool expandVertices_ {false};
+   };
+
+   std::vector<float>         vertices_ {};
+   std::vector<std::uint8_t>  dataMoments8_ {};
+   std::vector<std::uint16_t> dataMoments16_ {};
+   std::vector<std::uint8_t>  cfpMoments_ {};
+   RadarMesh                  mesh_ {};
+
+   /**
+    * Builds the sweep, replacing any existing contents. Expanded buffers are
+    * left empty unless requested by the parameters. Bins with a data
+    * moment below the SNR threshold are not displayed, unless range folded.
+    * Coordinate radials are adjacent to the following radial, wrapping to the
+    * first radial.
+    *
+    * @param radials Radials of the sweep
+    * @param parameters Sweep parameters
+    * @param parallel Build radials in parallel, or serially on the calling
+    * thread
+    */
+   void Build(std::span<const Radial> radials,
+              const Parameters&       parameters,
+              bool                    parallel = true);
+
+   /**
+    * Clears all buffers.
+    */
+   void Clear();
+
+   /**
+    * Memory allocated by the sweep in bytes, excluding the shared coordinate
+    * grid.
+    */
+   std::size_t memory_usage() const;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,42 @@
+cmake_minimum_required(VERSION 3.20)
+project(scwx-benchmark CXX)
+
+find_package(benchmark)
+find_package(Boost)
+find_package(BZip2)
+find_package(ZLIB)
+
+set(SRC_UTIL_BENCHMARKS source/scwx/util/compression.benchmark.cpp
+                        source/scwx/util/run_length.benchmark.cpp)
+set(SRC_WSR88D_RPG_BENCHMARKS source/scwx/wsr88d/rpg/packet_factory.benchmark.cpp)
+set(SRC_QT_UTIL_BENCHMARKS source/scwx/qt/util/radial_projector.benchmark.cpp)
+set(SRC_QT_VIEW_BENCHMARKS source/scwx/qt/view/radial_sweep.benchmark.cpp)
+
+set(CMAKE_FILES benchmark.cmake)
+
+add_executable(wxbenchmark ${SRC_UTIL_BENCHMARKS}
+                           ${SRC_WSR88D_RPG_BENCHMARKS}
+                           ${SRC_QT_UTIL_BENCHMARKS}
+                           ${SRC_QT_VIEW_BENCHMARKS}
+                           ${CMAKE_FILES})
+
+source_group("Source Files\\util"        FILES ${SRC_UTIL_BENCHMARKS})
+source_group("Source Files\\wsr88d\\rpg" FILES ${SRC_WSR88D_RPG_BENCHMARKS})
+source_group("Source Files\\qt\\util"    FILES ${SRC_QT_UTIL_BENCHMARKS})
+source_group("Source Files\\qt\\view"    FILES ${SRC_QT_VIEW_BENCHMARKS})
+
+set_target_properties(wxbenchmark PROPERTIES CXX_STANDARD 20
+                                             CXX_STANDARD_REQUIRED ON
+                                             CXX_EXTENSIONS OFF)
+
+if (MSVC)
+    set_target_properties(wxbenchmark PROPERTIES LINK_FLAGS "/ignore:4099")
+endif()
+
+target_include_directories(wxbenchmark PRIVATE ${SCWX_DIR}/test/source)
+
+target_compile_definitions(wxbenchmark PRIVATE SCWX_TEST_DATA_DIR="${SCWX_DIR}/test/data")
+
+target_link_libraries(wxbenchmark benchmark::benchmark_main
+                                  scwx-qt
+                                  wxdata)
@@ -0,0 +1,130 @@
+#include <scwx/qt/util/radial_projector.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/common/constants.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static constexpr double kLatitude_  = 38.6986;
+static constexpr double kLongitude_ = -90.6828;
+static constexpr double kGateSize_  = 250.0;
+static constexpr double kMaxRange_ =
+   kGateSize_ * common::MAX_DATA_MOMENT_GATES;
+
+static constexpr std::size_t kPoints_ =
+   common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
+
+// Projects each gate of a super resolution grid
+static void ProjectRadialProjector(benchmark::State& state)
+{
+   std::vector<float> coordinates(kPoints_ * 2);
+
+   const RadialProjector projector {kLatitude_, kLongitude_, kMaxRange_};
+
+   for (auto _ : state)
+   {
+      for (std::size_t radial = 0; radial < common::MAX_0_5_DEGREE_RADIALS;
+           ++radial)
+      {
+         projector.Project(
+            radial * 0.5 - 0.25,
+            kGateSize_,
+            kGateSize_,
+            std::span<float> {coordinates}.subspan(
+               radial * common::MAX_DATA_MOMENT_GATES * 2,
+               common::MAX_DATA_MOMENT_GATES * 2));
+      }
+
+      benchmark::ClobberMemory();
+   }
+
+   state.counters["degree"] = static_cast<double>(projector.degree());
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(kPoints_));
+}
+
+// Includes the per-site cost of fitting the series
+static void ProjectRadialProjectorWithSetup(benchmark::State& state)
+{
+   std::vector<float> coordinates(kPoints_ * 2);
+
+   for (auto _ : state)
+   {
+      const RadialProjector projector {kLatitude_, kLongitude_, kMaxRange_};
+
+      for (std::size_t radial = 0; radial < common::MAX_0_5_DEGREE_RADIALS;
+           ++radial)
+      {
+         projector.Project(
+            radial * 0.5 - 0.25,
+            kGateSize_,
+            kGateSize_,
+            std::span<float> {coordinates}.subspan(
+               radial * common::MAX_DATA_MOMENT_GATES * 2,
+               common::MAX_DATA_MOMENT_GATES * 2));
+      }
+
+      benchmark::ClobberMemory();
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(kPoints_));
+}
+
+// Solves the direct geodesic problem for each gate of a super resolution grid
+static void ProjectGeodesic(benchmark::State& state)
+{
+   const auto& geodesic = GeographicLib::DefaultGeodesic();
+
+   std::vector<float> coordinates(kPoints_ * 2);
+
+   for (auto _ : state)
+   {
+      for (std::size_t radial = 0; radial < common::MAX_0_5_DEGREE_RADIALS;
+           ++radial)
+      {
+         for (std::size_t gate = 0; gate < common::MAX_DATA_MOMENT_GATES;
+              ++gate)
+         {
+            const std::size_t offset =
+               (radial * common::MAX_DATA_MOMENT_GATES + gate) * 2;
+
+            double latitude;
+            double longitude;
+
+            geodesic.Direct(kLatitude_,
+                            kLongitude_,
+                            radial * 0.5 - 0.25,
+                            (gate + 1) * kGateSize_,
+                            latitude,
+                            longitude);
+
+            coordinates[offset]     = static_cast<float>(latitude);
+            coordinates[offset + 1] = static_cast<float>(longitude);
+         }
+      }
+
+      benchmark::ClobberMemory();
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(kPoints_));
+}
+
+BENCHMARK(ProjectRadialProjector)->Unit(benchmark::kMillisecond);
+BENCHMARK(ProjectRadialProjectorWithSetup)->Unit(benchmark::kMillisecond);
+BENCHMARK(ProjectGeodesic)->Unit(benchmark::kMillisecond);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
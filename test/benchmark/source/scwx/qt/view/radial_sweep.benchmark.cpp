@@ -0,0 +1,58 @@
+#include <scwx/qt/view/radial_sweep.hpp>
+#include <scwx/qt/view/radial_sweep_data.hpp>
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static constexpr std::size_t   kRadials_  = 720u;
+static constexpr std::uint16_t kBinCount_ = 1832u;
+
+static const SweepData& GetSweepData()
+{
+   static const SweepData data =
+      CreateSweepData(kRadials_, 0u, 1u, kBinCount_, 8u, true);
+
+   return data;
+}
+
+/**
+ * Builds a 720 radial super resolution sweep. Arguments select a parallel
+ * build, and whether expanded vertices are built in addition to the mesh.
+ */
+static void BuildRadialSweep(benchmark::State& state)
+{
+   const SweepData&        data       = GetSweepData();
+   const bool              parallel   = state.range(0) != 0;
+   RadialSweep::Parameters parameters = data.parameters_;
+   parameters.expandVertices_         = state.range(1) != 0;
+
+   RadialSweep sweep;
+
+   for (auto _ : state)
+   {
+      sweep.Build(data.radials_, parameters, parallel);
+      benchmark::DoNotOptimize(sweep.mesh_);
+   }
+
+   state.counters["memory"] = static_cast<double>(sweep.memory_usage());
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(kRadials_ * kBinCount_));
+}
+
+BENCHMARK(BuildRadialSweep)
+   ->ArgNames({"parallel", "expand"})
+   ->ArgsProduct({{0, 1}, {0, 1}})
+   ->Unit(benchmark::kMillisecond)
+   ->UseRealTime();
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,187 @@
+#include <scwx/util/compression.hpp>
+
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4702)
+#endif
+
+#if defined(__GNUC__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeprecated-copy"
+#endif
+
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/filtering_streambuf.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/bzip2.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+
+#if defined(__GNUC__)
+#   pragma GCC diagnostic pop
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#include <benchmark/benchmark.h>
+#include <bzlib.h>
+#include <zlib.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static constexpr std::size_t kDataSize_ = 16u << 20;
+
+// Runs of random values, which compress similarly to radar moment data
+static const std::vector<char>& TestData()
+{
+   static const std::vector<char> data = []()
+   {
+      std::vector<char>                  data(kDataSize_);
+      std::mt19937                       generator {0u};
+      std::uniform_int_distribution<int> value {0, 255};
+      std::uniform_int_distribution<int> runLength {1, 16};
+
+      for (std::size_t i = 0; i < data.size();)
+      {
+         const char        c = static_cast<char>(value(generator));
+         const std::size_t n = static_cast<std::size_t>(runLength(generator));
+         for (std::size_t j = 0; j < n && i < data.size(); ++j, ++i)
+         {
+            data[i] = c;
+         }
+      }
+
+      return data;
+   }();
+
+   return data;
+}
+
+static const std::vector<char>& Bzip2Data()
+{
+   static const std::vector<char> compressedData = []()
+   {
+      const std::vector<char>& data = TestData();
+
+      unsigned int      size = static_cast<unsigned int>(data.size() * 2 + 600);
+      std::vector<char> compressedData(size);
+      BZ2_bzBuffToBuffCompress(compressedData.data(),
+                               &size,
+                               const_cast<char*>(data.data()),
+                               static_cast<unsigned int>(data.size()),
+                               9,
+                               0,
+                               0);
+      compressedData.resize(size);
+      return compressedData;
+   }();
+
+   return compressedData;
+}
+
+static const std::vector<char>& ZlibData()
+{
+   static const std::vector<char> compressedData = []()
+   {
+      const std::vector<char>& data = TestData();
+
+      uLongf            size = compressBound(static_cast<uLong>(data.size()));
+      std::vector<char> compressedData(size);
+      compress(reinterpret_cast<Bytef*>(compressedData.data()),
+               &size,
+               reinterpret_cast<const Bytef*>(data.data()),
+               static_cast<uLong>(data.size()));
+      compressedData.resize(size);
+      return compressedData;
+   }();
+
+   return compressedData;
+}
+
+static void DecompressBzip2Iostreams(benchmark::State& state)
+{
+   const std::vector<char>& compressedData = Bzip2Data();
+
+   for (auto _ : state)
+   {
+      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+      in.push(boost::iostreams::bzip2_decompressor());
+      in.push(boost::iostreams::array_source(compressedData.data(),
+                                             compressedData.size()));
+      std::vector<char> output {};
+      boost::iostreams::copy(in, boost::iostreams::back_inserter(output));
+      benchmark::DoNotOptimize(output.data());
+   }
+
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(kDataSize_));
+}
+
+static void DecompressBzip2Direct(benchmark::State& state)
+{
+   const std::vector<char>& compressedData = Bzip2Data();
+
+   for (auto _ : state)
+   {
+      std::vector<char> output {};
+      benchmark::DoNotOptimize(DecompressBzip2(compressedData, output));
+      benchmark::DoNotOptimize(output.data());
+   }
+
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(kDataSize_));
+}
+
+static void DecompressZlibIostreams(benchmark::State& state)
+{
+   const std::vector<char>& compressedData = ZlibData();
+
+   for (auto _ : state)
+   {
+      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+      in.push(boost::iostreams::zlib_decompressor());
+      in.push(boost::iostreams::array_source(compressedData.data(),
+                                             compressedData.size()));
+      std::stringstream ss {};
+      boost::iostreams::copy(in, ss);
+      benchmark::DoNotOptimize(ss);
+   }
+
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(kDataSize_));
+}
+
+static void DecompressZlibDirect(benchmark::State& state)
+{
+   const std::vector<char>& compressedData = ZlibData();
+
+   for (auto _ : state)
+   {
+      std::vector<char> output {};
+      std::size_t       bytesConsumed = 0;
+      benchmark::DoNotOptimize(
+         DecompressZlib(compressedData, output, bytesConsumed));
+      benchmark::DoNotOptimize(output.data());
+   }
+
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(kDataSize_));
+}
+
+BENCHMARK(DecompressBzip2Iostreams)->Unit(benchmark::kMillisecond);
+BENCHMARK(DecompressBzip2Direct)->Unit(benchmark::kMillisecond);
+BENCHMARK(DecompressZlibIostreams)->Unit(benchmark::kMillisecond);
+BENCHMARK(DecompressZlibDirect)->Unit(benchmark::kMillisecond);
+
+} // namespace util
+} // namespace scwx
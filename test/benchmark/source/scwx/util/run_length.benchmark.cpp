@@ -0,0 +1,80 @@
+#include <scwx/util/run_length.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static constexpr std::size_t kDataSize_ = 16u << 20;
+
+static const std::vector<std::uint8_t>& TestData()
+{
+   static const std::vector<std::uint8_t> data = []()
+   {
+      std::vector<std::uint8_t>          data(kDataSize_);
+      std::mt19937                       generator {0u};
+      std::uniform_int_distribution<int> byte {0, 255};
+
+      for (auto& b : data)
+      {
+         b = static_cast<std::uint8_t>(byte(generator));
+      }
+
+      return data;
+   }();
+
+   return data;
+}
+
+template<std::size_t (*Decode)(std::span<const std::uint8_t>,
+                               std::span<std::uint8_t>)>
+static void DecodeRunLengthBenchmark(benchmark::State& state)
+{
+   const std::vector<std::uint8_t>& data = TestData();
+   std::vector<std::uint8_t>        output(CountRunLengthScalar(data));
+
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(Decode(data, output));
+      benchmark::ClobberMemory();
+   }
+
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(kDataSize_));
+}
+
+template<std::size_t (*Count)(std::span<const std::uint8_t>)>
+static void CountRunLengthBenchmark(benchmark::State& state)
+{
+   const std::vector<std::uint8_t>& data = TestData();
+
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(Count(data));
+   }
+
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(kDataSize_));
+}
+
+BENCHMARK(DecodeRunLengthBenchmark<DecodeRunLengthScalar>)
+   ->Name("DecodeRunLengthScalar")
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK(DecodeRunLengthBenchmark<DecodeRunLength>)
+   ->Name("DecodeRunLength")
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK(CountRunLengthBenchmark<CountRunLengthScalar>)
+   ->Name("CountRunLengthScalar")
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK(CountRunLengthBenchmark<CountRunLength>)
+   ->Name("CountRunLength")
+   ->Unit(benchmark::kMillisecond);
+
+} // namespace util
+} // namespace scwx
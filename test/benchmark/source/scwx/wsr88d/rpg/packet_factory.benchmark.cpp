@@ -0,0 +1,92 @@
+#include <scwx/wsr88d/rpg/packet_factory.hpp>
+#include <scwx/util/arenabuf.hpp>
+
+#include <cstdint>
+#include <initializer_list>
+#include <istream>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rpg
+{
+
+static constexpr std::size_t kPacketGroups_ = 100000u;
+
+static void AppendHalfwords(std::vector<char>&                   data,
+                            std::initializer_list<std::uint16_t> halfwords)
+{
+   for (std::uint16_t halfword : halfwords)
+   {
+      data.push_back(static_cast<char>(halfword >> 8));
+      data.push_back(static_cast<char>(halfword & 0xff));
+   }
+}
+
+// Storm ID, hail index and mesocyclone packets, as contained in storm
+// tracking, hail index and mesocyclone products
+static std::shared_ptr<std::vector<char>> GraphicPackets()
+{
+   static const std::shared_ptr<std::vector<char>> data = []()
+   {
+      auto data = std::make_shared<std::vector<char>>();
+
+      for (std::size_t i = 0; i < kPacketGroups_; ++i)
+      {
+         const std::uint16_t position = static_cast<std::uint16_t>(i % 1000u);
+
+         // Packet code, length of block, i, j, storm ID
+         AppendHalfwords(*data, {15, 6, position, position});
+         data->push_back('A');
+         data->push_back('0');
+
+         // Packet code, length of block, i, j, POH, POSH, max hail size
+         AppendHalfwords(*data, {19, 10, position, position, 30, 10, 2});
+
+         // Packet code, length of block, i, j, radius
+         AppendHalfwords(*data, {3, 6, position, position, 8});
+      }
+
+      return data;
+   }();
+
+   return data;
+}
+
+static void CreateGraphicPackets(benchmark::State& state)
+{
+   const std::shared_ptr<std::vector<char>> data        = GraphicPackets();
+   std::int64_t                             packetCount = 0;
+
+   for (auto _ : state)
+   {
+      util::arenabuf dataBuffer {data, 0, data->size()};
+      std::istream   dataStream {&dataBuffer};
+
+      while (PacketFactory::Create(dataStream) != nullptr)
+      {
+         ++packetCount;
+      }
+   }
+
+   if (packetCount !=
+       static_cast<std::int64_t>(state.iterations() * kPacketGroups_ * 3u))
+   {
+      state.SkipWithError("Unexpected packet count");
+   }
+
+   state.SetItemsProcessed(packetCount);
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(data->size()));
+}
+
+BENCHMARK(CreateGraphicPackets)->Unit(benchmark::kMillisecond);
+
+} // namespace rpg
+} // namespace wsr88d
+} // namespace scwx
@@ -0,0 +1,101 @@
+#include <scwx/qt/util/polar_coordinate_cache.hpp>
+#include <scwx/common/constants.hpp>
+
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static std::vector<float> CreateAzimuths(std::size_t radials,
+                                         float       offset = 0.0f)
+{
+   std::vector<float> azimuths(radials);
+   for (std::size_t i = 0; i < radials; ++i)
+   {
+      azimuths[i] = (i + 0.5f) * 360.0f / radials + offset;
+   }
+   return azimuths;
+}
+
+static PolarGridKey CreateKey(const std::vector<float>& azimuths)
+{
+   return PolarCoordinateCache::CreateKey(38.6986,
+                                          -90.6828,
+                                          250.0f,
+                                          common::MAX_DATA_MOMENT_GATES,
+                                          azimuths);
+}
+
+TEST(PolarCoordinateCache, HitAndMiss)
+{
+   PolarCoordinateCache cache {};
+
+   auto coordinates1 = cache.GetCoordinates(CreateKey(CreateAzimuths(360)));
+
+   // Azimuths within the quantization interval share a grid
+   auto coordinates2 =
+      cache.GetCoordinates(CreateKey(CreateAzimuths(360, 0.002f)));
+
+   ASSERT_NE(coordinates1, nullptr);
+   EXPECT_EQ(coordinates1, coordinates2);
+   EXPECT_EQ(coordinates1->size(),
+             360u * common::MAX_DATA_MOMENT_GATES * 2u);
+   EXPECT_EQ(cache.miss_count(), 1u);
+   EXPECT_EQ(cache.hit_count(), 1u);
+   EXPECT_EQ(cache.size(), 1u);
+   EXPECT_GT(cache.memory_usage(), coordinates1->size() * sizeof(float));
+
+   // A different azimuth layout requires a new grid
+   auto coordinates3 =
+      cache.GetCoordinates(CreateKey(CreateAzimuths(360, 0.1f)));
+   EXPECT_NE(coordinates3, coordinates1);
+   EXPECT_EQ(cache.miss_count(), 2u);
+   EXPECT_EQ(cache.size(), 2u);
+
+   // The first coordinate of the first radial is one gate from the radar, at
+   // the counterclockwise edge of the radial (due north)
+   EXPECT_GT((*coordinates1)[0], 38.6986f);
+   EXPECT_NEAR((*coordinates1)[1], -90.6828f, 0.0001f);
+
+   cache.Clear();
+   EXPECT_EQ(cache.size(), 0u);
+   EXPECT_EQ(cache.memory_usage(), 0u);
+}
+
+TEST(PolarCoordinateCache, MemoryLimit)
+{
+   const std::size_t gridSize =
+      90u * common::MAX_DATA_MOMENT_GATES * 2u * sizeof(float) +
+      90u * sizeof(std::int32_t);
+
+   PolarCoordinateCache cache {gridSize * 2u};
+
+   auto coordinates1 = cache.GetCoordinates(CreateKey(CreateAzimuths(90)));
+   auto coordinates2 =
+      cache.GetCoordinates(CreateKey(CreateAzimuths(90, 1.0f)));
+
+   // Use the first grid, making the second grid least recently used
+   EXPECT_EQ(cache.GetCoordinates(CreateKey(CreateAzimuths(90))),
+             coordinates1);
+
+   cache.GetCoordinates(CreateKey(CreateAzimuths(90, 2.0f)));
+   EXPECT_EQ(cache.size(), 2u);
+   EXPECT_EQ(cache.memory_usage(), gridSize * 2u);
+   EXPECT_EQ(cache.GetCoordinates(CreateKey(CreateAzimuths(90))),
+             coordinates1);
+   EXPECT_NE(cache.GetCoordinates(CreateKey(CreateAzimuths(90, 1.0f))),
+             coordinates2);
+
+   cache.SetMemoryLimit(gridSize);
+   EXPECT_EQ(cache.size(), 1u);
+   EXPECT_EQ(cache.memory_limit(), gridSize);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
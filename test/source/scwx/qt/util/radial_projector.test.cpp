@@ -0,0 +1,112 @@
+#include <scwx/qt/util/radial_projector.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/common/constants.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static constexpr double kGateSize_ = 250.0;
+static constexpr double kMaxRange_ =
+   kGateSize_ * common::MAX_DATA_MOMENT_GATES;
+
+static double Distance(double latitude1,
+                       double longitude1,
+                       double latitude2,
+                       double longitude2)
+{
+   static const double kMetersPerDegree =
+      ::GeographicLib::Constants::WGS84_a() * std::numbers::pi / 180.0;
+
+   const double dy = (latitude2 - latitude1) * kMetersPerDegree;
+   const double dx = std::remainder(longitude2 - longitude1, 360.0) *
+                     kMetersPerDegree *
+                     std::cos(latitude1 * std::numbers::pi / 180.0);
+
+   return std::sqrt(dx * dx + dy * dy);
+}
+
+class RadialProjectorTest :
+    public testing::TestWithParam<std::pair<double, double>>
+{
+};
+
+TEST_P(RadialProjectorTest, CompareGeodesic)
+{
+   auto [latitude, longitude] = GetParam();
+
+   const RadialProjector projector {latitude, longitude, kMaxRange_};
+   const auto& geodesic = GeographicLib::DefaultGeodesic();
+
+   EXPECT_GT(projector.degree(), 0u);
+
+   std::vector<double> coordinates(common::MAX_DATA_MOMENT_GATES * 2);
+   double              maxError = 0.0;
+
+   // Compare a super resolution grid against the exact solution
+   for (std::size_t radial = 0; radial < common::MAX_0_5_DEGREE_RADIALS;
+        ++radial)
+   {
+      const double azimuth = radial * 0.5 - 0.25;
+
+      projector.Project(azimuth, kGateSize_, kGateSize_, coordinates);
+
+      for (std::size_t gate = 0; gate < common::MAX_DATA_MOMENT_GATES; ++gate)
+      {
+         double gateLatitude;
+         double gateLongitude;
+
+         geodesic.Direct(latitude,
+                         longitude,
+                         azimuth,
+                         (gate + 1) * kGateSize_,
+                         gateLatitude,
+                         gateLongitude);
+
+         maxError = std::max(maxError,
+                             Distance(gateLatitude,
+                                      gateLongitude,
+                                      coordinates[gate * 2],
+                                      coordinates[gate * 2 + 1]));
+      }
+   }
+
+   EXPECT_LT(maxError, projector.max_error());
+}
+
+INSTANTIATE_TEST_SUITE_P(RadialProjector,
+                         RadialProjectorTest,
+                         testing::Values(std::make_pair(38.6986, -90.6828),
+                                         std::make_pair(64.5114, -165.2950),
+                                         std::make_pair(13.4558, 144.8111),
+                                         std::make_pair(-14.2667, -170.5)));
+
+TEST(RadialProjector, BeyondMaxRange)
+{
+   const RadialProjector projector {38.6986, -90.6828, 10000.0};
+   const auto&           geodesic = GeographicLib::DefaultGeodesic();
+
+   std::vector<float> coordinates(8);
+   projector.Project(45.0, 5000.0, 5000.0, coordinates);
+
+   // The final points are solved exactly
+   double latitude;
+   double longitude;
+   geodesic.Direct(38.6986, -90.6828, 45.0, 20000.0, latitude, longitude);
+
+   EXPECT_FLOAT_EQ(coordinates[6], static_cast<float>(latitude));
+   EXPECT_FLOAT_EQ(coordinates[7], static_cast<float>(longitude));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
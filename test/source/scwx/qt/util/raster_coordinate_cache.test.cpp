@@ -0,0 +1,74 @@
+#include <scwx/qt/util/raster_coordinate_cache.hpp>
+
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static RasterGridKey CreateKey(std::uint16_t rows)
+{
+   return {.latitude_    = 38.6986f,
+           .longitude_   = -90.6828f,
+           .range_       = 230.0f,
+           .xResolution_ = 1000,
+           .yResolution_ = 1000,
+           .iStart_      = -232,
+           .jStart_      = 232,
+           .rows_        = rows,
+           .columns_     = 464};
+}
+
+TEST(RasterCoordinateCache, HitAndMiss)
+{
+   RasterCoordinateCache cache {};
+
+   auto coordinates1 = cache.GetCoordinates(CreateKey(464));
+   auto coordinates2 = cache.GetCoordinates(CreateKey(464));
+
+   ASSERT_NE(coordinates1, nullptr);
+   EXPECT_EQ(coordinates1, coordinates2);
+   EXPECT_EQ(coordinates1->size(), 465u * 465u * 2u);
+   EXPECT_EQ(cache.miss_count(), 1u);
+   EXPECT_EQ(cache.hit_count(), 1u);
+   EXPECT_EQ(cache.size(), 1u);
+
+   // Cached coordinates match calculated coordinates
+   EXPECT_EQ(*coordinates1,
+             RasterCoordinateCache::CalculateCoordinates(CreateKey(464)));
+
+   cache.Clear();
+   EXPECT_EQ(cache.size(), 0u);
+   EXPECT_NE(cache.GetCoordinates(CreateKey(464)), coordinates1);
+   EXPECT_EQ(cache.miss_count(), 2u);
+}
+
+TEST(RasterCoordinateCache, Eviction)
+{
+   RasterCoordinateCache cache {2u};
+
+   auto coordinates1 = cache.GetCoordinates(CreateKey(1));
+   auto coordinates2 = cache.GetCoordinates(CreateKey(2));
+
+   // Use the first grid, making the second grid least recently used
+   EXPECT_EQ(cache.GetCoordinates(CreateKey(1)), coordinates1);
+
+   cache.GetCoordinates(CreateKey(3));
+   EXPECT_EQ(cache.size(), 2u);
+   EXPECT_EQ(cache.GetCoordinates(CreateKey(1)), coordinates1);
+   EXPECT_NE(cache.GetCoordinates(CreateKey(2)), coordinates2);
+
+   EXPECT_EQ(cache.hit_count(), 2u);
+   EXPECT_EQ(cache.miss_count(), 4u);
+
+   cache.SetCapacity(1u);
+   EXPECT_EQ(cache.size(), 1u);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
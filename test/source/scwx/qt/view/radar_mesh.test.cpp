@@ -0,0 +1,137 @@
+#include <scwx/qt/view/radar_mesh.hpp>
+#include <scwx/common/constants.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static constexpr float         kRadarLatitude_  = 38.0f;
+static constexpr float         kRadarLongitude_ = -90.0f;
+static constexpr std::uint16_t kRadials_        = 4u;
+
+/**
+ * Creates a synthetic coordinate grid, where the latitude of each point is its
+ * radial, and the longitude of each point is its gate.
+ */
+static std::shared_ptr<const std::vector<float>> CreateCoordinates()
+{
+   auto coordinates = std::make_shared<std::vector<float>>(
+      kRadials_ * common::MAX_DATA_MOMENT_GATES * 2);
+
+   for (std::size_t radial = 0; radial < kRadials_; ++radial)
+   {
+      for (std::size_t gate = 0; gate < common::MAX_DATA_MOMENT_GATES; ++gate)
+      {
+         const std::size_t offset =
+            (radial * common::MAX_DATA_MOMENT_GATES + gate) * 2;
+
+         (*coordinates)[offset]     = static_cast<float>(radial);
+         (*coordinates)[offset + 1] = static_cast<float>(gate);
+      }
+   }
+
+   return coordinates;
+}
+
+static RadarMesh CreateMesh()
+{
+   RadarMesh mesh;
+
+   mesh.coordinates_ = CreateCoordinates();
+   mesh.radials_     = kRadials_;
+   mesh.latitude_    = kRadarLatitude_;
+   mesh.longitude_   = kRadarLongitude_;
+
+   return mesh;
+}
+
+TEST(RadarMesh, PackGate)
+{
+   constexpr std::uint32_t packedGate = RadarMesh::PackGate(719u, 1839u, 4u);
+
+   std::uint32_t radial;
+   std::uint32_t gate;
+   std::uint32_t gateSize;
+
+   RadarMesh::UnpackGate(packedGate, radial, gate, gateSize);
+
+   EXPECT_EQ(radial, 719u);
+   EXPECT_EQ(gate, 1839u);
+   EXPECT_EQ(gateSize, 4u);
+}
+
+TEST(RadarMesh, ExpandGate)
+{
+   RadarMesh mesh = CreateMesh();
+   mesh.gates_.push_back(RadarMesh::PackGate(1u, 9u, 4u));
+   mesh.dataMoments8_.push_back(2u);
+
+   // Two triangles, with corners ordered 1, 2, 3, 3, 4, 2
+   const std::vector<float> expected {1.0f,
+                                      8.0f,
+                                      1.0f,
+                                      12.0f,
+                                      2.0f,
+                                      8.0f,
+                                      2.0f,
+                                      8.0f,
+                                      2.0f,
+                                      12.0f,
+                                      1.0f,
+                                      12.0f};
+
+   EXPECT_EQ(mesh.ExpandVertices(), expected);
+}
+
+TEST(RadarMesh, ExpandFirstGate)
+{
+   RadarMesh mesh = CreateMesh();
+   mesh.gates_.push_back(RadarMesh::PackGate(3u, 0u, 1u));
+   mesh.dataMoments8_.push_back(2u);
+
+   // A single triangle from the radar, wrapping to the first radial
+   const std::vector<float> expected {
+      kRadarLatitude_, kRadarLongitude_, 3.0f, 0.0f, 0.0f, 0.0f};
+
+   EXPECT_EQ(mesh.ExpandVertices(), expected);
+}
+
+TEST(RadarMesh, SweepDataSize)
+{
+   RadarMesh mesh = CreateMesh();
+
+   for (std::uint32_t radial = 0; radial < kRadials_; ++radial)
+   {
+      for (std::uint32_t gate = 1; gate < common::MAX_DATA_MOMENT_GATES;
+           ++gate)
+      {
+         mesh.gates_.push_back(RadarMesh::PackGate(radial, gate, 1u));
+         mesh.dataMoments8_.push_back(2u);
+      }
+   }
+
+   // Expanded vertices include a coordinate, data moment and CFP moment
+   const std::size_t expandedSize =
+      mesh.ExpandVertices().size() / 2 * (sizeof(float) * 2 + 2);
+
+   EXPECT_EQ(mesh.gate_count(), mesh.gates_.size());
+   EXPECT_EQ(mesh.sweep_data_size(), mesh.gate_count() * 5);
+   EXPECT_GE(expandedSize, mesh.sweep_data_size() * 10);
+
+   mesh.Clear();
+   EXPECT_TRUE(mesh.empty());
+   EXPECT_EQ(mesh.coordinates_, nullptr);
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,245 @@
+#include <scwx/qt/view/radial_sweep.hpp>
+#include <scwx/qt/view/radial_sweep_data.hpp>
+#include <scwx/common/constants.hpp>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * Reference serial build, using running vertex and moment cursors.
+ */
+template<class T>
+static void BuildSerial(const SweepData& data,
+                        RadialSweep&     sweep,
+                        std::vector<T>&  dataMoments)
+{
+   const std::vector<float>& coordinates = *data.coordinates_;
+   const std::size_t         radials     = data.radials_.size();
+
+   std::size_t vIndex = 0;
+   std::size_t mIndex = 0;
+
+   for (const RadialSweep::Radial& radial : data.radials_)
+   {
+      const T* moments;
+      if constexpr (sizeof(T) == 1)
+      {
+         moments = radial.dataMoments8_;
+      }
+      else
+      {
+         moments = radial.dataMoments16_;
+      }
+
+      for (std::size_t i = 0; i < radial.binCount_; ++i)
+      {
+         const T dataValue = moments[i];
+         if (dataValue < data.parameters_.snrThreshold_ &&
+             dataValue != kRangeFolded_)
+         {
+            continue;
+         }
+
+         const std::size_t gate = radial.startGate_ + i * radial.gateSize_;
+         const std::size_t offset1 =
+            radial.coordinateRadial_ * common::MAX_DATA_MOMENT_GATES * 2;
+         const std::size_t offset2 = (radial.coordinateRadial_ + 1) % radials *
+                                     common::MAX_DATA_MOMENT_GATES * 2;
+         std::size_t vertexCount;
+
+         if (gate > 0)
+         {
+            const std::size_t o1 = offset1 + (gate - 1) * 2;
+            const std::size_t o2 = o1 + radial.gateSize_ * 2;
+            const std::size_t o3 = offset2 + (gate - 1) * 2;
+            const std::size_t o4 = o3 + radial.gateSize_ * 2;
+
+            for (std::size_t o : {o1, o2, o3, o3, o4, o2})
+            {
+               sweep.vertices_[vIndex++] = coordinates[o];
+               sweep.vertices_[vIndex++] = coordinates[o + 1];
+            }
+
+            vertexCount = 6;
+         }
+         else
+         {
+            sweep.vertices_[vIndex++] = kRadarLatitude_;
+            sweep.vertices_[vIndex++] = kRadarLongitude_;
+
+            for (std::size_t o : {offset1, offset2})
+            {
+               sweep.vertices_[vIndex++] = coordinates[o];
+               sweep.vertices_[vIndex++] = coordinates[o + 1];
+            }
+
+            vertexCount = 3;
+         }
+
+         for (std::size_t m = 0; m < vertexCount; ++m)
+         {
+            dataMoments[mIndex] = dataValue;
+            if (data.parameters_.cfpEnabled_)
+            {
+               sweep.cfpMoments_[mIndex] =
+                  (radial.cfpMoments_ != nullptr) ? radial.cfpMoments_[i] : 0u;
+            }
+            ++mIndex;
+         }
+      }
+   }
+
+   sweep.vertices_.resize(vIndex);
+   dataMoments.resize(mIndex);
+   sweep.cfpMoments_.resize(data.parameters_.cfpEnabled_ ? mIndex : 0u);
+}
+
+static RadialSweep BuildSerial(const SweepData& data)
+{
+   const std::size_t maxVertices = data.dataMoments8_.size() * 6;
+
+   RadialSweep sweep;
+   sweep.vertices_.resize(maxVertices * 2);
+   sweep.cfpMoments_.resize(maxVertices);
+
+   if (data.parameters_.dataWordSize_ == 8)
+   {
+      sweep.dataMoments8_.resize(maxVertices);
+      BuildSerial(data, sweep, sweep.dataMoments8_);
+   }
+   else
+   {
+      sweep.dataMoments16_.resize(maxVertices);
+      BuildSerial(data, sweep, sweep.dataMoments16_);
+   }
+
+   return sweep;
+}
+
+template<class T>
+static bool BytesEqual(const std::vector<T>& a, const std::vector<T>& b)
+{
+   return a.size() == b.size() &&
+          std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+}
+
+static void ExpectEqual(const SweepData& data)
+{
+   const RadialSweep expected = BuildSerial(data);
+
+   RadialSweep sweep;
+   sweep.Build(data.radials_, data.parameters_);
+
+   EXPECT_TRUE(BytesEqual(sweep.vertices_, expected.vertices_));
+   EXPECT_TRUE(BytesEqual(sweep.dataMoments8_, expected.dataMoments8_));
+   EXPECT_TRUE(BytesEqual(sweep.dataMoments16_, expected.dataMoments16_));
+   EXPECT_TRUE(BytesEqual(sweep.cfpMoments_, expected.cfpMoments_));
+   EXPECT_FALSE(sweep.vertices_.empty());
+
+   // The indexed mesh expands to the same vertices
+   EXPECT_TRUE(BytesEqual(sweep.mesh_.ExpandVertices(), expected.vertices_));
+}
+
+TEST(RadialSweep, SuperResolution8Bit)
+{
+   ExpectEqual(CreateSweepData(720u, 0u, 1u, 1832u, 8u, true));
+}
+
+TEST(RadialSweep, SuperResolution16Bit)
+{
+   ExpectEqual(CreateSweepData(720u, 8u, 1u, 1192u, 16u, false));
+}
+
+TEST(RadialSweep, StartRadial)
+{
+   ExpectEqual(CreateSweepData(360u, 0u, 4u, 230u, 8u, false, 137u));
+}
+
+TEST(RadialSweep, Rebuild)
+{
+   const SweepData data1 = CreateSweepData(720u, 0u, 1u, 1832u, 8u, true);
+   const SweepData data2 = CreateSweepData(360u, 2u, 4u, 230u, 16u, false);
+
+   RadialSweep sweep;
+   sweep.Build(data1.radials_, data1.parameters_);
+   sweep.Build(data2.radials_, data2.parameters_);
+
+   const RadialSweep expected = BuildSerial(data2);
+
+   EXPECT_TRUE(BytesEqual(sweep.vertices_, expected.vertices_));
+   EXPECT_TRUE(sweep.dataMoments8_.empty());
+   EXPECT_TRUE(BytesEqual(sweep.dataMoments16_, expected.dataMoments16_));
+   EXPECT_TRUE(sweep.cfpMoments_.empty());
+   EXPECT_TRUE(sweep.mesh_.dataMoments8_.empty());
+   EXPECT_TRUE(sweep.mesh_.cfpMoments_.empty());
+   EXPECT_EQ(sweep.mesh_.radials_, 360u);
+}
+
+TEST(RadialSweep, MeshOnly)
+{
+   SweepData data = CreateSweepData(720u, 0u, 1u, 1832u, 8u, true);
+
+   RadialSweep expandedSweep;
+   expandedSweep.Build(data.radials_, data.parameters_);
+
+   data.parameters_.expandVertices_ = false;
+
+   RadialSweep sweep;
+   sweep.Build(data.radials_, data.parameters_);
+
+   EXPECT_TRUE(sweep.vertices_.empty());
+   EXPECT_TRUE(sweep.dataMoments8_.empty());
+   EXPECT_TRUE(sweep.cfpMoments_.empty());
+
+   EXPECT_TRUE(BytesEqual(sweep.mesh_.gates_, expandedSweep.mesh_.gates_));
+   EXPECT_TRUE(BytesEqual(sweep.mesh_.dataMoments8_,
+                          expandedSweep.mesh_.dataMoments8_));
+   EXPECT_TRUE(
+      BytesEqual(sweep.mesh_.cfpMoments_, expandedSweep.mesh_.cfpMoments_));
+   EXPECT_TRUE(BytesEqual(sweep.mesh_.ExpandVertices(),
+                          expandedSweep.vertices_));
+
+   // Memory usage includes only the indexed mesh
+   EXPECT_EQ(sweep.memory_usage(), sweep.mesh_.gate_count() * 6);
+}
+
+TEST(RadialSweep, Serial)
+{
+   const SweepData data = CreateSweepData(720u, 0u, 1u, 1832u, 8u, true);
+
+   RadialSweep parallelSweep;
+   RadialSweep serialSweep;
+   parallelSweep.Build(data.radials_, data.parameters_, true);
+   serialSweep.Build(data.radials_, data.parameters_, false);
+
+   EXPECT_TRUE(BytesEqual(serialSweep.vertices_, parallelSweep.vertices_));
+   EXPECT_TRUE(
+      BytesEqual(serialSweep.dataMoments8_, parallelSweep.dataMoments8_));
+   EXPECT_TRUE(BytesEqual(serialSweep.cfpMoments_, parallelSweep.cfpMoments_));
+   EXPECT_TRUE(
+      BytesEqual(serialSweep.mesh_.gates_, parallelSweep.mesh_.gates_));
+
+   // Memory usage includes both the expanded vertices and the indexed mesh
+   const std::size_t gates    = serialSweep.mesh_.gate_count();
+   const std::size_t vertices = serialSweep.dataMoments8_.size();
+   EXPECT_EQ(serialSweep.memory_usage(),
+             vertices * (sizeof(float) * 2 + 2) + gates * 6);
+
+   serialSweep.Clear();
+   EXPECT_TRUE(serialSweep.vertices_.empty());
+   EXPECT_TRUE(serialSweep.mesh_.empty());
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <scwx/qt/view/radial_sweep.hpp>
+#include <scwx/common/constants.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static constexpr float         kRadarLatitude_  = 38.0f;
+static constexpr float         kRadarLongitude_ = -90.0f;
+static constexpr std::uint16_t kRangeFolded_    = 1u;
+
+/**
+ * @brief Synthetic sweep data, with moments in [0, 255] such that roughly a
+ * quarter of bins fall below the SNR threshold. Shared by the radial sweep
+ * tests and benchmarks.
+ */
+struct SweepData
+{
+   std::shared_ptr<std::vector<float>> coordinates_ {};
+   std::vector<std::uint8_t>           dataMoments8_ {};
+   std::vector<std::uint16_t>          dataMoments16_ {};
+   std::vector<std::uint8_t>           cfpMoments_ {};
+   std::vector<RadialSweep::Radial>    radials_ {};
+   RadialSweep::Parameters             parameters_ {};
+};
+
+inline SweepData CreateSweepData(std::size_t   radials,
+                                 std::uint16_t startGate,
+                                 std::uint16_t gateSize,
+                                 std::uint16_t binCount,
+                                 std::uint8_t  dataWordSize,
+                                 bool          cfpEnabled,
+                                 std::size_t   startRadial = 0u)
+{
+   std::mt19937                            generator {radials + gateSize};
+   std::uniform_real_distribution<float>   coordinate {-180.0f, 180.0f};
+   std::uniform_int_distribution<unsigned> moment {0u, 255u};
+
+   SweepData data;
+
+   data.coordinates_ = std::make_shared<std::vector<float>>(
+      radials * common::MAX_DATA_MOMENT_GATES * 2);
+   for (float& value : *data.coordinates_)
+   {
+      value = coordinate(generator);
+   }
+
+   const std::size_t bins = radials * binCount;
+
+   data.dataMoments8_.resize(bins);
+   data.dataMoments16_.resize(bins);
+   data.cfpMoments_.resize(bins);
+
+   for (std::size_t i = 0; i < bins; ++i)
+   {
+      data.dataMoments8_[i]  = static_cast<std::uint8_t>(moment(generator));
+      data.dataMoments16_[i] = static_cast<std::uint16_t>(moment(generator));
+      data.cfpMoments_[i]    = static_cast<std::uint8_t>(moment(generator));
+   }
+
+   data.radials_.resize(radials);
+   for (std::size_t radial = 0; radial < radials; ++radial)
+   {
+      RadialSweep::Radial& sweepRadial = data.radials_[radial];
+
+      sweepRadial.coordinateRadial_ =
+         static_cast<std::uint16_t>((startRadial + radial) % radials);
+      sweepRadial.startGate_ = startGate;
+      sweepRadial.gateSize_  = gateSize;
+      sweepRadial.binCount_  = binCount;
+
+      // Leave every eighth radial empty, and without CFP moments
+      if (radial % 8 == 7)
+      {
+         sweepRadial.binCount_ = 0;
+      }
+      else if (cfpEnabled)
+      {
+         sweepRadial.cfpMoments_ =
+            data.cfpMoments_.data() + radial * binCount;
+      }
+
+      if (dataWordSize == 8)
+      {
+         sweepRadial.dataMoments8_ =
+            data.dataMoments8_.data() + radial * binCount;
+      }
+      else
+      {
+         sweepRadial.dataMoments16_ =
+            data.dataMoments16_.data() + radial * binCount;
+      }
+   }
+
+   data.parameters_.coordinates_  = data.coordinates_;
+   data.parameters_.latitude_     = kRadarLatitude_;
+   data.parameters_.longitude_    = kRadarLongitude_;
+   data.parameters_.snrThreshold_ = 64u;
+   data.parameters_.dataWordSize_ = dataWordSize;
+   data.parameters_.cfpEnabled_   = cfpEnabled;
+
+   // Expanded vertices are built by default, to be compared against the
+   // serial reference
+   data.parameters_.expandVertices_ = true;
+
+   return data;
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,124 @@
+#include <scwx/util/arenabuf.hpp>
+
+#include <cstring>
+#include <istream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+class arenabuf_test : public ::testing::Test
+{
+protected:
+   arenabuf_test() :
+       arena_ {std::make_shared<std::vector<char>>(12)},
+       ab_ {arena_, 3, 6},
+       is_ {&ab_}
+   {
+   }
+   ~arenabuf_test() = default;
+
+   void SetUp() override { std::memcpy(arena_->data(), "xx smiles xx", 12); }
+
+   std::shared_ptr<std::vector<char>> arena_;
+   arenabuf                           ab_;
+   std::istream                       is_;
+};
+
+TEST_F(arenabuf_test, smiles)
+{
+   char data[7] = {0};
+   is_.read(data, 6);
+
+   EXPECT_EQ(std::string(data), std::string("smiles"));
+   EXPECT_EQ(is_.eof(), false);
+   EXPECT_EQ(is_.fail(), false);
+
+   is_.read(data, 1);
+
+   EXPECT_EQ(is_.eof(), true);
+   EXPECT_EQ(is_.fail(), true);
+}
+
+TEST_F(arenabuf_test, seekg_pos)
+{
+   std::streampos begin = is_.tellg();
+   is_.seekg(begin + std::streamoff(2));
+
+   char data[5] = {0};
+   is_.read(data, 4);
+
+   EXPECT_EQ(std::string(data), std::string("iles"));
+   EXPECT_EQ(is_.tellg(), 6);
+   EXPECT_EQ(is_.fail(), false);
+}
+
+TEST_F(arenabuf_test, seekg_cur)
+{
+   char data[4] = {0};
+   is_.read(data, 1);
+   is_.seekg(2, std::ios_base::cur);
+   is_.read(data, 3);
+
+   EXPECT_EQ(std::string(data), std::string("les"));
+   EXPECT_EQ(is_.fail(), false);
+}
+
+TEST_F(arenabuf_test, seekg_out_of_range)
+{
+   is_.seekg(7, std::ios_base::beg);
+
+   EXPECT_EQ(is_.fail(), true);
+}
+
+TEST_F(arenabuf_test, current)
+{
+   is_.seekg(-4, std::ios_base::end);
+
+   EXPECT_EQ(ab_.current(), arena_->data() + 5);
+   EXPECT_EQ(ab_.arena(), arena_);
+}
+
+TEST_F(arenabuf_test, read_in_place)
+{
+   std::vector<char> buffer {};
+
+   is_.seekg(1, std::ios_base::beg);
+   std::span<const char> data = ReadInPlace(is_, buffer, 3);
+
+   // Data is referenced in the arena, and the stream is advanced
+   EXPECT_EQ(data.data(), arena_->data() + 4);
+   EXPECT_EQ(std::string(data.begin(), data.end()), std::string("mil"));
+   EXPECT_EQ(buffer.empty(), true);
+   EXPECT_EQ(is_.tellg(), 4);
+
+   data = ReadInPlace(is_, buffer);
+
+   EXPECT_EQ(std::string(data.begin(), data.end()), std::string("es"));
+   EXPECT_EQ(buffer.empty(), true);
+}
+
+TEST(arenabuf, read_in_place_stream)
+{
+   std::istringstream is {"smiles"};
+   std::vector<char>  buffer {};
+
+   is.seekg(1, std::ios_base::beg);
+   std::span<const char> data = ReadInPlace(is, buffer, 3);
+
+   // Data which is not in an arena is read into the buffer
+   EXPECT_EQ(data.data(), buffer.data());
+   EXPECT_EQ(std::string(data.begin(), data.end()), std::string("mil"));
+   EXPECT_EQ(is.tellg(), 4);
+
+   data = ReadInPlace(is, buffer);
+
+   EXPECT_EQ(std::string(data.begin(), data.end()), std::string("es"));
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,75 @@
+#include <scwx/util/binary.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(binary, round_trip)
+{
+   const std::array<std::uint16_t, 3> values {1u, 2u, 300u};
+
+   std::ostringstream os {};
+   BinaryWriter       writer {os};
+
+   writer.Write<std::uint8_t>(7u);
+   writer.WriteArray<std::uint16_t>(values);
+   writer.Write<float>(1.5f);
+
+   EXPECT_EQ(writer.good(), true);
+
+   // Array data is aligned to 8 bytes
+   std::string data = os.str();
+   EXPECT_EQ(data.size(), 8u + values.size() * 2u + 4u);
+
+   // Copy the data into a buffer with the same alignment as a mapped file
+   std::vector<std::uint64_t> buffer((data.size() + 7u) / 8u);
+   std::memcpy(buffer.data(), data.data(), data.size());
+
+   BinaryReader reader {{reinterpret_cast<const char*>(buffer.data()),
+                         data.size()}};
+
+   std::uint8_t                   u8 {};
+   std::span<const std::uint16_t> array {};
+   float                          f {};
+
+   EXPECT_EQ(reader.Read(u8), true);
+   EXPECT_EQ(reader.ReadArray(values.size(), array), true);
+   EXPECT_EQ(reader.Read(f), true);
+
+   EXPECT_EQ(u8, 7u);
+   ASSERT_EQ(array.size(), values.size());
+   EXPECT_EQ(std::equal(array.begin(), array.end(), values.begin()), true);
+   EXPECT_EQ(f, 1.5f);
+   EXPECT_EQ(reader.good(), true);
+}
+
+TEST(binary, read_past_end)
+{
+   const char data[4] = {1, 2, 3, 4};
+
+   BinaryReader reader {data};
+
+   std::uint32_t                  u32 {};
+   std::span<const std::uint32_t> array {};
+
+   EXPECT_EQ(reader.Read(u32), true);
+   EXPECT_EQ(reader.Read(u32), false);
+   EXPECT_EQ(reader.good(), false);
+
+   BinaryReader arrayReader {data};
+   EXPECT_EQ(arrayReader.ReadArray(2u, array), false);
+   EXPECT_EQ(arrayReader.good(), false);
+}
+
+} // namespace util
+} // namespace scwx
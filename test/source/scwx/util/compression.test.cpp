@@ -0,0 +1,256 @@
+#include <scwx/util/compression.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <bzlib.h>
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+namespace scwx
+{
+namespace util
+{
+
+// Runs of random values, which compress similarly to radar moment data
+static std::vector<char> CreateTestData(std::size_t size)
+{
+   std::vector<char>                  data(size);
+   std::mt19937                       generator {0u};
+   std::uniform_int_distribution<int> value {0, 255};
+   std::uniform_int_distribution<int> runLength {1, 16};
+
+   for (std::size_t i = 0; i < size;)
+   {
+      const char        c = static_cast<char>(value(generator));
+      const std::size_t n = static_cast<std::size_t>(runLength(generator));
+      for (std::size_t j = 0; j < n && i < size; ++j, ++i)
+      {
+         data[i] = c;
+      }
+   }
+
+   return data;
+}
+
+static std::vector<char> CompressBzip2(const std::vector<char>& data)
+{
+   unsigned int      size = static_cast<unsigned int>(data.size() * 2 + 600);
+   std::vector<char> compressedData(size);
+   BZ2_bzBuffToBuffCompress(compressedData.data(),
+                            &size,
+                            const_cast<char*>(data.data()),
+                            static_cast<unsigned int>(data.size()),
+                            9,
+                            0,
+                            0);
+   compressedData.resize(size);
+   return compressedData;
+}
+
+static std::vector<char> CompressZlib(const std::vector<char>& data)
+{
+   uLongf            size = compressBound(static_cast<uLong>(data.size()));
+   std::vector<char> compressedData(size);
+   compress(reinterpret_cast<Bytef*>(compressedData.data()),
+            &size,
+            reinterpret_cast<const Bytef*>(data.data()),
+            static_cast<uLong>(data.size()));
+   compressedData.resize(size);
+   return compressedData;
+}
+
+static std::vector<char> CompressGzip(const std::vector<char>& data)
+{
+   z_stream stream {};
+   deflateInit2(&stream,
+                Z_DEFAULT_COMPRESSION,
+                Z_DEFLATED,
+                MAX_WBITS + 16,
+                8,
+                Z_DEFAULT_STRATEGY);
+
+   std::vector<char> compressedData(
+      deflateBound(&stream, static_cast<uLong>(data.size())));
+
+   stream.next_in =
+      reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+   stream.avail_in  = static_cast<uInt>(data.size());
+   stream.next_out  = reinterpret_cast<Bytef*>(compressedData.data());
+   stream.avail_out = static_cast<uInt>(compressedData.size());
+
+   deflate(&stream, Z_FINISH);
+   compressedData.resize(stream.total_out);
+   deflateEnd(&stream);
+
+   return compressedData;
+}
+
+TEST(compression, bzip2)
+{
+   const std::vector<char> data           = CreateTestData(1 << 20);
+   const std::vector<char> compressedData = CompressBzip2(data);
+
+   std::vector<char> output {};
+
+   EXPECT_EQ(DecompressBzip2(compressedData, output), true);
+   EXPECT_EQ(output, data);
+}
+
+TEST(compression, bzip2_reserved)
+{
+   const std::vector<char> data           = CreateTestData(1 << 16);
+   const std::vector<char> compressedData = CompressBzip2(data);
+
+   std::vector<char> output {'x'};
+   output.reserve(data.size() + 1);
+   const char* outputData = output.data();
+
+   EXPECT_EQ(DecompressBzip2(compressedData, output), true);
+
+   // Decompressed data is appended without reallocating
+   EXPECT_EQ(output.data(), outputData);
+   ASSERT_EQ(output.size(), data.size() + 1);
+   EXPECT_EQ(output[0], 'x');
+   EXPECT_EQ(std::equal(data.cbegin(), data.cend(), output.cbegin() + 1),
+             true);
+}
+
+TEST(compression, bzip2_truncated)
+{
+   const std::vector<char> data           = CreateTestData(1 << 16);
+   const std::vector<char> compressedData = CompressBzip2(data);
+
+   std::vector<char> output {};
+
+   std::span<const char> truncatedData {compressedData.data(),
+                                        compressedData.size() / 2};
+
+   EXPECT_EQ(DecompressBzip2(truncatedData, output), false);
+}
+
+TEST(compression, bzip2_prefix)
+{
+   const std::vector<char> data           = CreateTestData(1 << 16);
+   const std::vector<char> compressedData = CompressBzip2(data);
+
+   std::vector<char> output {};
+
+   // Only the requested size is decompressed
+   EXPECT_EQ(DecompressBzip2Prefix(compressedData, output, 1000), true);
+   ASSERT_EQ(output.size(), 1000u);
+   EXPECT_EQ(std::equal(output.cbegin(), output.cend(), data.cbegin()), true);
+
+   // A stream shorter than the requested size is decompressed in full
+   output.clear();
+   EXPECT_EQ(DecompressBzip2Prefix(compressedData, output, data.size() * 2),
+             true);
+   EXPECT_EQ(output, data);
+}
+
+TEST(compression, zlib_consecutive_streams)
+{
+   const std::vector<char> data1 = CreateTestData(1 << 16);
+   const std::vector<char> data2 = CreateTestData(1 << 12);
+
+   std::vector<char> compressedData  = CompressZlib(data1);
+   const std::size_t stream1Size     = compressedData.size();
+   const auto        compressedData2 = CompressZlib(data2);
+   compressedData.insert(
+      compressedData.end(), compressedData2.cbegin(), compressedData2.cend());
+
+   std::vector<char> output {};
+   std::size_t       bytesConsumed = 0;
+
+   EXPECT_EQ(DecompressZlib(compressedData, output, bytesConsumed), true);
+   EXPECT_EQ(bytesConsumed, stream1Size);
+   EXPECT_EQ(output, data1);
+
+   output.clear();
+
+   EXPECT_EQ(DecompressZlib(std::span {compressedData}.subspan(bytesConsumed),
+                            output,
+                            bytesConsumed),
+             true);
+   EXPECT_EQ(bytesConsumed, compressedData2.size());
+   EXPECT_EQ(output, data2);
+}
+
+TEST(compression, gzip_consecutive_members)
+{
+   const std::vector<char> data1 = CreateTestData(1 << 16);
+   const std::vector<char> data2 = CreateTestData(1 << 12);
+
+   std::vector<char> compressedData  = CompressGzip(data1);
+   const std::size_t member1Size     = compressedData.size();
+   const auto        compressedData2 = CompressGzip(data2);
+   compressedData.insert(
+      compressedData.end(), compressedData2.cbegin(), compressedData2.cend());
+
+   std::vector<char> output {};
+   std::size_t       bytesConsumed = 0;
+
+   EXPECT_EQ(DecompressGzip(compressedData, output, bytesConsumed), true);
+   EXPECT_EQ(bytesConsumed, member1Size);
+   EXPECT_EQ(output, data1);
+
+   // Members are appended to the output
+   EXPECT_EQ(DecompressGzip(std::span {compressedData}.subspan(bytesConsumed),
+                            output,
+                            bytesConsumed),
+             true);
+   EXPECT_EQ(bytesConsumed, compressedData2.size());
+   EXPECT_EQ(output.size(), data1.size() + data2.size());
+   EXPECT_EQ(std::equal(data2.cbegin(), data2.cend(), output.cbegin() +
+                           static_cast<std::ptrdiff_t>(data1.size())),
+             true);
+}
+
+TEST(compression, gzip_zlib_data)
+{
+   const std::vector<char> data           = CreateTestData(1 << 12);
+   const std::vector<char> compressedData = CompressZlib(data);
+
+   std::vector<char> output {};
+   std::size_t       bytesConsumed = 0;
+
+   EXPECT_EQ(DecompressGzip(compressedData, output, bytesConsumed), false);
+}
+
+TEST(compression, zlib_prefix)
+{
+   const std::vector<char> data           = CreateTestData(1 << 16);
+   const std::vector<char> compressedData = CompressZlib(data);
+
+   std::vector<char> output {};
+
+   // Only the requested size is decompressed, even from truncated input
+   EXPECT_EQ(DecompressZlibPrefix(
+                std::span {compressedData}.first(compressedData.size() / 2),
+                output,
+                1000),
+             true);
+   ASSERT_EQ(output.size(), 1000u);
+   EXPECT_EQ(std::equal(output.cbegin(), output.cend(), data.cbegin()), true);
+
+   // A stream shorter than the requested size is decompressed in full
+   output.clear();
+   EXPECT_EQ(DecompressZlibPrefix(compressedData, output, data.size() * 2),
+             true);
+   EXPECT_EQ(output, data);
+}
+
+TEST(compression, zlib_invalid)
+{
+   const std::vector<char> data {'n', 'o', 't', ' ', 'z', 'l', 'i', 'b'};
+
+   std::vector<char> output {};
+   std::size_t       bytesConsumed = 0;
+
+   EXPECT_EQ(DecompressZlib(data, output, bytesConsumed), false);
+}
+
+} // namespace util
+} // namespace scwx
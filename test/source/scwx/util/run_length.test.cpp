@@ -0,0 +1,130 @@
+#include <scwx/util/run_length.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static std::vector<std::uint8_t> CreateTestData(std::size_t   size,
+                                                std::uint32_t seed)
+{
+   std::vector<std::uint8_t>          data(size);
+   std::mt19937                       generator {seed};
+   std::uniform_int_distribution<int> byte {0, 255};
+
+   for (auto& b : data)
+   {
+      b = static_cast<std::uint8_t>(byte(generator));
+   }
+
+   return data;
+}
+
+TEST(run_length, decode)
+{
+   const std::vector<std::uint8_t> data {0x31, 0x00, 0x25, 0x1f};
+   std::vector<std::uint8_t>       output(8, 0xff);
+
+   EXPECT_EQ(DecodeRunLength(data, output), 6u);
+   EXPECT_EQ(output,
+             (std::vector<std::uint8_t> {1, 1, 1, 5, 5, 15, 0, 0}));
+}
+
+TEST(run_length, decode_truncated)
+{
+   const std::vector<std::uint8_t> data {0xf3, 0xf4};
+   std::vector<std::uint8_t>       output(20, 0xff);
+
+   // Decoding stops when the output is full
+   EXPECT_EQ(DecodeRunLength(data, std::span {output}.first(17)), 17u);
+   EXPECT_EQ(output[14], 3);
+   EXPECT_EQ(output[15], 4);
+   EXPECT_EQ(output[16], 4);
+   EXPECT_EQ(output[17], 0xff);
+}
+
+TEST(run_length, empty)
+{
+   const std::vector<std::uint8_t> data {};
+   std::vector<std::uint8_t>       output(4, 0xff);
+
+   EXPECT_EQ(DecodeRunLength(data, output), 0u);
+   EXPECT_EQ(CountRunLength(data), 0u);
+   EXPECT_EQ(DecodeRunLength(std::vector<std::uint8_t> {0x00, 0x0a}, output),
+             0u);
+   EXPECT_EQ(output, (std::vector<std::uint8_t>(4, 0)));
+}
+
+TEST(run_length, radial_data_packet)
+{
+   // Radial with 12 range bins and a trailing pad byte. Expected levels are
+   // those produced by the original RadialDataPacket decoder.
+   const std::vector<std::uint8_t> data {0x30, 0x52, 0x1f, 0x24, 0x00};
+   std::vector<std::uint8_t>       output(12, 0xff);
+
+   EXPECT_EQ(DecodeRunLength(data, output), 11u);
+   EXPECT_EQ(output,
+             (std::vector<std::uint8_t> {0, 0, 0, 2, 2, 2, 2, 2, 15, 4, 4, 0}));
+
+   // Runs exceeding the number of range bins are truncated
+   const std::vector<std::uint8_t> longData {0xf7, 0xf8, 0x19};
+   std::vector<std::uint8_t>       longOutput(20, 0xff);
+
+   EXPECT_EQ(DecodeRunLength(longData, longOutput), 20u);
+   EXPECT_EQ(longOutput,
+             (std::vector<std::uint8_t> {7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                                         7, 7, 7, 7, 7, 8, 8, 8, 8, 8}));
+}
+
+TEST(run_length, raster_data_packet)
+{
+   // Raster row sized by the sum of its runs. Expected levels are those
+   // produced by the original RasterDataPacket decoder.
+   const std::vector<std::uint8_t> data {0x13, 0xf0, 0x07, 0x42, 0x00};
+
+   ASSERT_EQ(CountRunLength(data), 20u);
+   ASSERT_EQ(CountRunLengthScalar(data), 20u);
+
+   std::vector<std::uint8_t> output(CountRunLength(data), 0xff);
+
+   EXPECT_EQ(DecodeRunLength(data, output), 20u);
+   EXPECT_EQ(output,
+             (std::vector<std::uint8_t> {3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                         0, 0, 0, 0, 0, 0, 2, 2, 2, 2}));
+}
+
+TEST(run_length, matches_scalar)
+{
+   std::mt19937                          generator {1u};
+   std::uniform_int_distribution<size_t> outputPadding {0, 64};
+
+   for (std::size_t size = 0; size < 600; ++size)
+   {
+      const std::vector<std::uint8_t> data =
+         CreateTestData(size, static_cast<std::uint32_t>(size));
+      const std::size_t count = CountRunLengthScalar(data);
+
+      EXPECT_EQ(CountRunLength(data), count);
+
+      // Output buffers both shorter and longer than the decoded data
+      const std::size_t outputSize =
+         count / 2 + outputPadding(generator) * count / 32 +
+         outputPadding(generator);
+
+      std::vector<std::uint8_t> expected(outputSize, 0xff);
+      std::vector<std::uint8_t> output(outputSize, 0xff);
+
+      EXPECT_EQ(DecodeRunLength(data, output),
+                DecodeRunLengthScalar(data, expected));
+      EXPECT_EQ(output, expected);
+   }
+}
+
+} // namespace util
+} // namespace scwx
@@ -1,6 +1,16 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/rda/level2_message_factory.hpp>
+#include <scwx/wsr88d/rda/packed_elevation_scan.hpp>
+#include <scwx/wsr88d/rda/rda_status_data.hpp>
+#include <scwx/util/binary.hpp>
+#include <scwx/util/compression.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <set>
+#include <sstream>
 
 #include <gtest/gtest.h>
 
@@ -9,12 +19,102 @@ namespace scwx
 namespace wsr88d
 {
 
+static const std::string kKlsxFilename_ =
+   std::string(SCWX_TEST_DATA_DIR) +
+   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+// Splits a volume at LDM record boundaries. The first chunk contains the
+// Volume Header Record and the metadata record.
+static std::vector<std::string> SplitLDMRecords(const std::string& filename)
+{
+   static constexpr std::size_t kVolumeHeaderSize_ = 24u;
+
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   std::string   data {std::istreambuf_iterator<char>(f),
+                     std::istreambuf_iterator<char>()};
+
+   std::vector<std::string> chunks {};
+   std::size_t              offset = kVolumeHeaderSize_;
+   while (offset + 4 <= data.size())
+   {
+      const auto* controlWord =
+         reinterpret_cast<const std::uint8_t*>(data.data() + offset);
+      const std::int32_t recordSize = static_cast<std::int32_t>(
+         static_cast<std::uint32_t>(controlWord[0]) << 24 |
+         static_cast<std::uint32_t>(controlWord[1]) << 16 |
+         static_cast<std::uint32_t>(controlWord[2]) << 8 |
+         static_cast<std::uint32_t>(controlWord[3]));
+      const std::size_t begin = chunks.empty() ? 0u : offset;
+
+      offset += 4 + static_cast<std::size_t>(std::abs(recordSize));
+      chunks.push_back(data.substr(begin, offset - begin));
+   }
+
+   return chunks;
+}
+
+// Decodes the radials of an elevation cut independently of Ar2vFile
+static rda::ElevationScan
+DecodeElevation(const std::vector<std::string>& chunks,
+                std::uint16_t                   elevationIndex)
+{
+   static constexpr std::size_t kCtmHeaderSize_ = 12u;
+
+   rda::ElevationScan elevationScan {};
+
+   auto ctx = rda::Level2MessageFactory::CreateContext(
+      {rda::MessageId::DigitalRadarData});
+
+   for (std::size_t i = 1; i < chunks.size(); ++i)
+   {
+      std::vector<char> recordData {};
+      if (!util::DecompressBzip2(std::span<const char> {chunks[i]}.subspan(4),
+                                 recordData))
+      {
+         continue;
+      }
+
+      std::istringstream is {
+         std::string {recordData.begin(), recordData.end()}};
+      is.seekg(kCtmHeaderSize_, std::ios_base::beg);
+
+      while (true)
+      {
+         // Messages may be separated by zero padding
+         std::uint16_t nextSize = 0u;
+         while (is.read(reinterpret_cast<char*>(&nextSize), 2) && nextSize == 0)
+         {
+         }
+         if (!is)
+         {
+            break;
+         }
+         is.seekg(-2, std::ios_base::cur);
+
+         rda::Level2MessageInfo msgInfo =
+            rda::Level2MessageFactory::Create(is, ctx);
+         if (!msgInfo.headerValid)
+         {
+            break;
+         }
+
+         auto radial =
+            std::dynamic_pointer_cast<rda::DigitalRadarData>(msgInfo.message);
+         if (radial != nullptr &&
+             radial->elevation_number() - 1 == elevationIndex)
+         {
+            elevationScan[radial->azimuth_number() - 1] = radial;
+         }
+      }
+   }
+
+   return elevationScan;
+}
+
 TEST(ar2v_file, klsx)
 {
    Ar2vFile file;
-   bool     fileValid =
-      file.LoadFile(std::string(SCWX_TEST_DATA_DIR) +
-                    "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v");
+   bool     fileValid = file.LoadFile(kKlsxFilename_);
 
    EXPECT_EQ(fileValid, true);
 }
@@ -29,5 +129,340 @@ TEST(ar2v_file, tstl)
    EXPECT_EQ(fileValid, true);
 }
 
+TEST(ar2v_file, klsx_incremental)
+{
+   std::vector<std::string> chunks = SplitLDMRecords(kKlsxFilename_);
+
+   ASSERT_GT(chunks.size(), 2u);
+
+   Ar2vFile                file;
+   std::set<std::uint16_t> completedElevations {};
+
+   file.SetElevationCompleteCallback(
+      [&](std::uint16_t elevationIndex, float /* elevation */)
+      { completedElevations.insert(elevationIndex); });
+
+   // Load records until the first elevation cut is complete
+   std::size_t chunk = 0;
+   for (; chunk < chunks.size() && completedElevations.empty(); ++chunk)
+   {
+      std::istringstream is {chunks[chunk]};
+      EXPECT_EQ(file.LoadLDMRecords(is), true);
+   }
+
+   ASSERT_LT(chunk, chunks.size());
+   ASSERT_EQ(completedElevations, std::set<std::uint16_t> {0u});
+
+   // The first cut is visible before later records are received. The
+   // velocity cut at the same elevation has not been received.
+   auto [refScan, refCut, refCuts] =
+      file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+   EXPECT_NE(refScan, nullptr);
+   EXPECT_EQ(refCuts.size(), 1u);
+   EXPECT_EQ(std::get<0>(file.GetPackedElevationScan(
+                rda::DataBlockType::MomentVel, 0.5f, {})),
+             nullptr);
+
+   // Load the remaining records
+   for (; chunk < chunks.size(); ++chunk)
+   {
+      std::istringstream is {chunks[chunk]};
+      EXPECT_EQ(file.LoadLDMRecords(is), true);
+   }
+
+   EXPECT_GT(completedElevations.size(), 1u);
+   EXPECT_NE(std::get<0>(file.GetPackedElevationScan(
+                rda::DataBlockType::MomentVel, 0.5f, {})),
+             nullptr);
+
+   // The same cuts are indexed as when the volume is loaded at once
+   Ar2vFile fullFile;
+   ASSERT_EQ(fullFile.LoadFile(kKlsxFilename_), true);
+
+   for (rda::DataBlockType type : rda::MomentDataBlockTypeIterator())
+   {
+      EXPECT_EQ(std::get<2>(file.GetPackedElevationScan(type, 0.5f, {})),
+                std::get<2>(fullFile.GetPackedElevationScan(type, 0.5f, {})));
+   }
+}
+
+TEST(ar2v_file, klsx_packed)
+{
+   Ar2vFile file;
+   bool     fileValid = file.LoadFile(kKlsxFilename_);
+
+   EXPECT_EQ(fileValid, true);
+
+   auto [packedScan, packedCut, packedCuts] =
+      file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+   rda::ElevationScan elevationScan =
+      DecodeElevation(SplitLDMRecords(kKlsxFilename_), 0u);
+
+   ASSERT_NE(packedScan, nullptr);
+   ASSERT_EQ(elevationScan.empty(), false);
+   EXPECT_EQ(packedScan->radial_count(), elevationScan.size());
+   ASSERT_EQ(packedScan->has_moment(rda::DataBlockType::MomentRef), true);
+
+   const rda::DataBlockType type   = rda::DataBlockType::MomentRef;
+   const std::size_t        stride = packedScan->gate_stride(type);
+   const auto               data8  = packedScan->data_moments8(type);
+   const auto gates = packedScan->number_of_data_moment_gates(type);
+
+   EXPECT_EQ(packedScan->packed_size(type), data8.size_bytes());
+
+   std::size_t r = 0;
+   for (auto& radial : elevationScan)
+   {
+      auto momentData = radial.second->moment_data_block(type);
+      ASSERT_NE(momentData, nullptr);
+      ASSERT_EQ(gates[r], momentData->number_of_data_moment_gates());
+      EXPECT_EQ(packedScan->azimuth_angles()[r],
+                radial.second->azimuth_angle());
+
+      auto expected = momentData->data_moments8();
+      EXPECT_EQ(std::equal(expected.begin(),
+                           expected.end(),
+                           data8.begin() + r * stride),
+                true);
+      ++r;
+   }
+}
+
+TEST(ar2v_file, klsx_elevation_cut_time)
+{
+   const auto summary = Ar2vFile::ReadSummaryFile(kKlsxFilename_);
+
+   Ar2vFile file;
+   bool     fileValid = file.LoadFile(kKlsxFilename_);
+
+   ASSERT_EQ(fileValid, true);
+   ASSERT_EQ(summary.has_value(), true);
+
+   // Each cut containing velocity data is selected by its own start time,
+   // including repeated cuts at the same elevation angle
+   for (auto& cut : summary->elevationCuts_)
+   {
+      if (std::find(cut.moments_.cbegin(),
+                    cut.moments_.cend(),
+                    rda::DataBlockType::MomentVel) == cut.moments_.cend())
+      {
+         continue;
+      }
+
+      auto [scan, elevationCut, elevationCuts] = file.GetPackedElevationScan(
+         rda::DataBlockType::MomentVel, cut.elevationAngle_, cut.startTime_);
+
+      ASSERT_NE(scan, nullptr);
+      EXPECT_EQ(scan->start_time(), cut.startTime_);
+   }
+}
+
+TEST(ar2v_file, klsx_deferred_metadata)
+{
+   Ar2vFile file;
+   bool     fileValid = file.LoadFile(kKlsxFilename_);
+
+   EXPECT_EQ(fileValid, true);
+
+   // RDA Status Data is deferred during load, and decoded on request
+   auto message = file.GetMetadataMessage(rda::MessageId::RdaStatusData);
+   auto rdaStatusData = std::dynamic_pointer_cast<rda::RdaStatusData>(message);
+
+   ASSERT_NE(rdaStatusData, nullptr);
+   EXPECT_EQ(file.GetMetadataMessage(rda::MessageId::RdaStatusData),
+             rdaStatusData);
+}
+
+TEST(ar2v_file, klsx_eager_metadata)
+{
+   Ar2vLoadOptions options {};
+   options.eagerMessageTypes_.insert(rda::MessageId::RdaStatusData);
+
+   Ar2vFile file;
+   bool     fileValid = file.LoadFile(kKlsxFilename_, options);
+
+   EXPECT_EQ(fileValid, true);
+
+   // RDA Status Data is decoded during load
+   auto message = file.GetMetadataMessage(rda::MessageId::RdaStatusData);
+
+   EXPECT_NE(std::dynamic_pointer_cast<rda::RdaStatusData>(message), nullptr);
+   EXPECT_NE(std::get<0>(file.GetPackedElevationScan(
+                rda::DataBlockType::MomentRef, 0.5f, {})),
+             nullptr);
+}
+
+TEST(ar2v_file, klsx_no_eager_messages)
+{
+   Ar2vLoadOptions options {};
+   options.eagerMessageTypes_ = {};
+
+   Ar2vFile file;
+   bool     fileValid = file.LoadFile(kKlsxFilename_, options);
+
+   EXPECT_EQ(fileValid, true);
+
+   // Digital Radar Data is decoded regardless of the options
+   auto [scan, elevationCut, elevationCuts] =
+      file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+
+   ASSERT_NE(scan, nullptr);
+   EXPECT_GT(scan->radial_count(), 0u);
+   EXPECT_EQ(elevationCuts.empty(), false);
+}
+
+TEST(ar2v_file, klsx_summary)
+{
+   auto summary = Ar2vFile::ReadSummaryFile(kKlsxFilename_);
+
+   Ar2vFile file;
+   bool     fileValid = file.LoadFile(kKlsxFilename_);
+
+   ASSERT_EQ(fileValid, true);
+   ASSERT_EQ(summary.has_value(), true);
+
+   EXPECT_EQ(summary->icao_, file.icao());
+   EXPECT_EQ(summary->startTime_, file.start_time());
+   EXPECT_EQ(summary->volumeCoveragePattern_,
+             file.vcp_data()->pattern_number());
+
+   ASSERT_EQ(summary->elevationCuts_.empty(), false);
+
+   for (auto& cut : summary->elevationCuts_)
+   {
+      ASSERT_EQ(cut.moments_.empty(), false);
+
+      for (auto& dataBlockType : cut.moments_)
+      {
+         // Reflectivity is not indexed for contiguous doppler cuts
+         auto [scan, elevationCut, elevationCuts] =
+            file.GetPackedElevationScan(
+               dataBlockType, cut.elevationAngle_, cut.startTime_);
+         if (scan != nullptr && scan->start_time() == cut.startTime_)
+         {
+            EXPECT_EQ(scan->has_moment(dataBlockType), true);
+         }
+         else
+         {
+            EXPECT_EQ(dataBlockType, rda::DataBlockType::MomentRef);
+         }
+      }
+   }
+}
+
+TEST(ar2v_file, klsx_cache)
+{
+   const std::string cacheFilename =
+      (std::filesystem::temp_directory_path() / "scwx_klsx_cache.ar2c")
+         .string();
+
+   Ar2vFile file;
+   bool     fileValid = file.LoadFile(kKlsxFilename_);
+
+   ASSERT_EQ(fileValid, true);
+   ASSERT_EQ(file.WriteCache(cacheFilename), true);
+
+   Ar2vFile cachedFile;
+   ASSERT_EQ(cachedFile.LoadCache(cacheFilename), true);
+
+   EXPECT_EQ(cachedFile.icao(), file.icao());
+   EXPECT_EQ(cachedFile.start_time(), file.start_time());
+   EXPECT_EQ(cachedFile.end_time(), file.end_time());
+   ASSERT_NE(cachedFile.vcp_data(), nullptr);
+   EXPECT_EQ(cachedFile.vcp_data()->pattern_number(),
+             file.vcp_data()->pattern_number());
+
+   for (rda::DataBlockType type : rda::MomentDataBlockTypeIterator())
+   {
+      auto [packedScan, packedCut, packedCuts] =
+         file.GetPackedElevationScan(type, 0.5f, {});
+      auto [cachedScan, cachedCut, cachedCuts] =
+         cachedFile.GetPackedElevationScan(type, 0.5f, {});
+
+      EXPECT_EQ(cachedCut, packedCut);
+      EXPECT_EQ(cachedCuts, packedCuts);
+
+      if (packedScan == nullptr)
+      {
+         EXPECT_EQ(cachedScan, nullptr);
+         continue;
+      }
+
+      ASSERT_NE(cachedScan, nullptr);
+      EXPECT_EQ(cachedScan->radial_count(), packedScan->radial_count());
+      EXPECT_EQ(cachedScan->start_time(), packedScan->start_time());
+      EXPECT_EQ(cachedScan->gate_stride(type), packedScan->gate_stride(type));
+      EXPECT_EQ(std::ranges::equal(cachedScan->azimuth_angles(),
+                                   packedScan->azimuth_angles()),
+                true);
+      EXPECT_EQ(
+         std::ranges::equal(cachedScan->number_of_data_moment_gates(type),
+                            packedScan->number_of_data_moment_gates(type)),
+         true);
+      EXPECT_EQ(std::ranges::equal(cachedScan->data_moments8(type),
+                                   packedScan->data_moments8(type)),
+                true);
+      EXPECT_EQ(std::ranges::equal(cachedScan->data_moments16(type),
+                                   packedScan->data_moments16(type)),
+                true);
+   }
+
+   std::filesystem::remove(cacheFilename);
+}
+
+TEST(ar2v_file, klsx_cache_invalid_moment)
+{
+   Ar2vFile file;
+   bool     fileValid = file.LoadFile(kKlsxFilename_);
+
+   ASSERT_EQ(fileValid, true);
+
+   auto [packedScan, packedCut, packedCuts] =
+      file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+   ASSERT_NE(packedScan, nullptr);
+
+   std::ostringstream os {};
+   util::BinaryWriter writer {os};
+   packedScan->Write(writer);
+
+   const std::string data = os.str();
+
+   // Reads the scan from a buffer with the same alignment as a mapped file
+   auto readScan = [](const std::string& scanData)
+   {
+      std::vector<std::uint64_t> buffer((scanData.size() + 7u) / 8u);
+      std::memcpy(buffer.data(), scanData.data(), scanData.size());
+
+      util::BinaryReader reader {
+         {reinterpret_cast<const char*>(buffer.data()), scanData.size()}};
+      return rda::PackedElevationScan::Read(reader, nullptr);
+   };
+
+   ASSERT_NE(readScan(data), nullptr);
+
+   // The first moment follows the scan header and the azimuth angles
+   const std::size_t momentOffset = 32u + packedScan->radial_count() * 4u;
+
+   // Data word size
+   std::string invalidWordSize = data;
+   invalidWordSize[momentOffset] = 12;
+   EXPECT_EQ(readScan(invalidWordSize), nullptr);
+
+   // Gate stride exceeding the buffer
+   std::string invalidGateStride = data;
+   const std::uint16_t gateStride = 0xffffu;
+   std::memcpy(&invalidGateStride[momentOffset + 1u], &gateStride, 2u);
+   EXPECT_EQ(readScan(invalidGateStride), nullptr);
+
+   // Gate stride smaller than the gates of a radial
+   std::string smallGateStride = data;
+   const std::uint16_t smallStride = 1u;
+   std::memcpy(&smallGateStride[momentOffset + 1u], &smallStride, 2u);
+   EXPECT_EQ(readScan(smallGateStride), nullptr);
+
+   // Truncated moment data
+   EXPECT_EQ(readScan(data.substr(0, data.size() - 1u)), nullptr);
+}
+
 } // namespace wsr88d
 } // namespace scwx
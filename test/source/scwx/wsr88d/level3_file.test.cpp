@@ -1,4 +1,9 @@
 #include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/util/time.hpp>
+
+#include <filesystem>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -7,6 +12,21 @@ namespace scwx
 namespace wsr88d
 {
 
+static const std::string kLevel3Directory_ =
+   std::string(SCWX_TEST_DATA_DIR) + "/nexrad/level3";
+
+static void ExpectSummaryEqual(const Level3ProductSummary& summary,
+                               const Level3ProductSummary& expected)
+{
+   EXPECT_EQ(summary.productCategory_, expected.productCategory_);
+   EXPECT_EQ(summary.productDesignator_, expected.productDesignator_);
+   EXPECT_EQ(summary.productCode_, expected.productCode_);
+   EXPECT_EQ(summary.elevationNumber_, expected.elevationNumber_);
+   EXPECT_EQ(summary.volumeCoveragePattern_, expected.volumeCoveragePattern_);
+   EXPECT_EQ(summary.time_, expected.time_);
+   EXPECT_EQ(summary.size_, expected.size_);
+}
+
 class Level3ValidFileTest :
     public testing::TestWithParam<std::pair<int16_t, std::string>>
 {
@@ -29,6 +49,42 @@ TEST_P(Level3ValidFileTest, ValidFile)
    EXPECT_EQ(message->header().message_code(), param.first);
 }
 
+TEST_P(Level3ValidFileTest, Summary)
+{
+   Level3File file;
+
+   auto param = GetParam();
+
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) +
+                               "/nexrad/level3/" + param.second};
+
+   auto summary   = Level3File::ReadSummaryFile(filename);
+   bool fileValid = file.LoadFile(filename);
+
+   ASSERT_EQ(fileValid, true);
+   ASSERT_EQ(summary.has_value(), true);
+
+   auto message          = file.message();
+   auto descriptionBlock = message->description_block();
+
+   EXPECT_EQ(summary->productCode_, param.first);
+   EXPECT_EQ(summary->productCategory_, file.wmo_header()->product_category());
+   EXPECT_EQ(summary->productDesignator_,
+             file.wmo_header()->product_designator());
+   EXPECT_EQ(summary->size_, std::filesystem::file_size(filename));
+
+   if (descriptionBlock != nullptr)
+   {
+      EXPECT_EQ(summary->elevationNumber_, descriptionBlock->elevation_number());
+      EXPECT_EQ(summary->volumeCoveragePattern_,
+                descriptionBlock->volume_coverage_pattern());
+      EXPECT_EQ(summary->time_,
+                util::TimePoint(descriptionBlock->volume_scan_date(),
+                                descriptionBlock->volume_scan_start_time() *
+                                   1000u));
+   }
+}
+
 INSTANTIATE_TEST_SUITE_P(
    Level3File,
    Level3ValidFileTest,
@@ -91,5 +147,56 @@ INSTANTIATE_TEST_SUITE_P(
       std::pair<int16_t, std::string> {186,
                                        "Level3_STL_TZL_20211211_0200.nids"}));
 
+TEST(Level3File, SummaryFiles)
+{
+   const std::vector<std::string> filenames {
+      kLevel3Directory_ + "/KLSX_SDUS53_N0RLSX_202105041639",
+      kLevel3Directory_ + "/nonexistent",
+      kLevel3Directory_ + "/KLSX_NXUS63_GSMLSX_202112110238",
+      kLevel3Directory_ + "/Level3_STL_NCR_20211211_0200.nids"};
+
+   auto summaries = Level3File::ReadSummaryFiles(filenames);
+
+   // Summaries are returned in the order of the filenames
+   ASSERT_EQ(summaries.size(), filenames.size());
+   EXPECT_EQ(summaries[1].has_value(), false);
+
+   for (std::size_t i = 0; i < filenames.size(); ++i)
+   {
+      auto expected = Level3File::ReadSummaryFile(filenames[i]);
+
+      ASSERT_EQ(summaries[i].has_value(), expected.has_value());
+      if (expected.has_value())
+      {
+         ExpectSummaryEqual(*summaries[i], *expected);
+      }
+   }
+}
+
+TEST(Level3File, SummaryDirectory)
+{
+   auto summaries = Level3File::ReadSummaryDirectory(kLevel3Directory_);
+
+   ASSERT_EQ(summaries.empty(), false);
+
+   for (auto& [filename, summary] : summaries)
+   {
+      auto expected = Level3File::ReadSummaryFile(filename);
+
+      ASSERT_EQ(expected.has_value(), true);
+      ExpectSummaryEqual(summary, *expected);
+   }
+
+   // Every Level 3 fixture in the directory is summarized
+   for (auto& entry : std::filesystem::directory_iterator {kLevel3Directory_})
+   {
+      if (entry.is_regular_file() &&
+          Level3File::ReadSummaryFile(entry.path().string()).has_value())
+      {
+         EXPECT_EQ(summaries.contains(entry.path().string()), true);
+      }
+   }
+}
+
 } // namespace wsr88d
 } // namespace scwx
@@ -0,0 +1,88 @@
+#include <scwx/wsr88d/rpg/packet_factory.hpp>
+#include <scwx/wsr88d/rpg/hda_hail_symbol_packet.hpp>
+#include <scwx/wsr88d/rpg/mesocyclone_symbol_packet.hpp>
+#include <scwx/wsr88d/rpg/storm_id_symbol_packet.hpp>
+
+#include <cstdint>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rpg
+{
+
+static void AppendHalfwords(std::string&                        data,
+                            std::initializer_list<std::uint16_t> halfwords)
+{
+   for (std::uint16_t halfword : halfwords)
+   {
+      data.push_back(static_cast<char>(halfword >> 8));
+      data.push_back(static_cast<char>(halfword & 0xff));
+   }
+}
+
+// Storm ID, hail index and mesocyclone packets, as contained in storm
+// tracking, hail index and mesocyclone products
+static std::string CreateGraphicPackets(std::size_t count)
+{
+   std::string data {};
+
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      const std::uint16_t position = static_cast<std::uint16_t>(i % 1000u);
+
+      // Packet code, length of block, i, j, storm ID
+      AppendHalfwords(data, {15, 6, position, position});
+      data.append("A0");
+
+      // Packet code, length of block, i, j, POH, POSH, max hail size
+      AppendHalfwords(data, {19, 10, position, position, 30, 10, 2});
+
+      // Packet code, length of block, i, j, radius
+      AppendHalfwords(data, {3, 6, position, position, 8});
+   }
+
+   return data;
+}
+
+TEST(PacketFactory, Create)
+{
+   std::istringstream is {CreateGraphicPackets(1)};
+
+   auto stormIdPacket = PacketFactory::Create(is);
+   auto hailPacket    = PacketFactory::Create(is);
+   auto mesoPacket    = PacketFactory::Create(is);
+
+   EXPECT_NE(std::dynamic_pointer_cast<StormIdSymbolPacket>(stormIdPacket),
+             nullptr);
+   EXPECT_NE(std::dynamic_pointer_cast<HdaHailSymbolPacket>(hailPacket),
+             nullptr);
+   EXPECT_NE(std::dynamic_pointer_cast<MesocycloneSymbolPacket>(mesoPacket),
+             nullptr);
+
+   // The end of the stream contains no packet
+   EXPECT_EQ(PacketFactory::Create(is), nullptr);
+}
+
+TEST(PacketFactory, CreateUnknown)
+{
+   std::string data {};
+   AppendHalfwords(data, {0x1234, 6, 0, 0, 0});
+
+   std::istringstream is {data};
+
+   EXPECT_EQ(PacketFactory::Create(is), nullptr);
+
+   // The stream is not advanced past an unknown packet code
+   EXPECT_EQ(is.tellg(), 0);
+}
+
+} // namespace rpg
+} // namespace wsr88d
+} // namespace scwx
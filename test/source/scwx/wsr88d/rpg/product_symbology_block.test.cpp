@@ -0,0 +1,118 @@
+#include <scwx/wsr88d/rpg/product_symbology_block.hpp>
+#include <scwx/wsr88d/rpg/radial_data_packet.hpp>
+#include <scwx/wsr88d/rpg/storm_id_symbol_packet.hpp>
+
+#include <cstdint>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rpg
+{
+
+static void AppendHalfwords(std::string&                        data,
+                            std::initializer_list<std::uint16_t> halfwords)
+{
+   for (std::uint16_t halfword : halfwords)
+   {
+      data.push_back(static_cast<char>(halfword >> 8));
+      data.push_back(static_cast<char>(halfword & 0xff));
+   }
+}
+
+static std::string CreateBlock(const std::vector<std::string>& layers)
+{
+   std::size_t blockLength = 10;
+   for (auto& layer : layers)
+   {
+      blockLength += 6 + layer.size();
+   }
+
+   std::string data {};
+
+   // Block divider, block ID, length of block, number of layers
+   AppendHalfwords(data,
+                   {0xFFFF,
+                    1,
+                    static_cast<std::uint16_t>(blockLength >> 16),
+                    static_cast<std::uint16_t>(blockLength & 0xffff),
+                    static_cast<std::uint16_t>(layers.size())});
+
+   for (auto& layer : layers)
+   {
+      // Layer divider, length of data layer
+      AppendHalfwords(data,
+                      {0xFFFF,
+                       static_cast<std::uint16_t>(layer.size() >> 16),
+                       static_cast<std::uint16_t>(layer.size() & 0xffff)});
+      data.append(layer);
+   }
+
+   return data;
+}
+
+static std::string CreateStormIdPacket(char id)
+{
+   std::string data {};
+
+   // Packet code, length of block, i, j, storm ID
+   AppendHalfwords(data, {15, 6, 10, 20});
+   data.append({id, '0'});
+
+   return data;
+}
+
+static std::string CreateRadialDataPacket()
+{
+   std::string data {};
+
+   // Packet code, first bin, bins, i, j, scale factor, radials
+   AppendHalfwords(data, {0xAF1F, 0, 2, 0, 0, 1000, 1});
+
+   // Radial: 2 bins of level 4, and a zero pad byte
+   AppendHalfwords(data, {1, 0, 10, 0x2400});
+
+   return data;
+}
+
+TEST(ProductSymbologyBlock, PacketIndex)
+{
+   std::istringstream is {
+      CreateBlock({CreateStormIdPacket('A') + CreateRadialDataPacket(),
+                   CreateStormIdPacket('B')})};
+
+   ProductSymbologyBlock block {};
+
+   ASSERT_EQ(block.Parse(is), true);
+   ASSERT_EQ(block.number_of_layers(), 2u);
+   EXPECT_EQ(block.packet_list(0).size(), 2u);
+   EXPECT_EQ(block.packet_list(1).size(), 1u);
+
+   // Packets are indexed by packet code across layers, in order
+   auto stormIdPackets = block.packets(15);
+   ASSERT_EQ(stormIdPackets.size(), 2u);
+   EXPECT_EQ(stormIdPackets[0], block.packet_list(0)[0]);
+   EXPECT_EQ(stormIdPackets[1], block.packet_list(1)[0]);
+   EXPECT_EQ(
+      std::static_pointer_cast<StormIdSymbolPacket>(stormIdPackets[1])
+         ->storm_id(0),
+      "B0");
+
+   EXPECT_EQ(block.packets(0xBA07).empty(), true);
+
+   // Data packets are available by type
+   EXPECT_EQ(block.radial_data_packet(), block.packet_list(0)[1]);
+   EXPECT_EQ(block.digital_radial_data_array_packet(), nullptr);
+   EXPECT_EQ(block.raster_data_packet(), nullptr);
+}
+
+} // namespace rpg
+} // namespace wsr88d
+} // namespace scwx
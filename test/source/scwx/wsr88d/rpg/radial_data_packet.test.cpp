@@ -0,0 +1,99 @@
+#include <scwx/wsr88d/rpg/radial_data_packet.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rpg
+{
+
+static void AppendHalfwords(std::string&                        data,
+                            std::initializer_list<std::uint16_t> halfwords)
+{
+   for (std::uint16_t halfword : halfwords)
+   {
+      data.push_back(static_cast<char>(halfword >> 8));
+      data.push_back(static_cast<char>(halfword & 0xff));
+   }
+}
+
+TEST(RadialDataPacket, RunLengthDecode)
+{
+   std::string data {};
+
+   // Packet code, first bin, bins, i, j, scale factor, radials
+   AppendHalfwords(data, {0xAF1F, 0, 4, 0, 0, 1000, 2});
+
+   // Radial 1: 2 bins of level 4, and a zero pad byte
+   AppendHalfwords(data, {1, 0, 10, 0x2400});
+
+   // Radial 2: 1 bin of level 3, 2 bins of level 1, 1 bin of level 5
+   AppendHalfwords(data, {2, 10, 10, 0x1321, 0x1500});
+
+   std::istringstream is {data};
+   auto               packet = RadialDataPacket::Create(is);
+
+   ASSERT_NE(packet, nullptr);
+   ASSERT_EQ(packet->number_of_radials(), 2u);
+   EXPECT_EQ(packet->start_angle(1), 1.0f);
+
+   const std::array<std::uint8_t, 4> expected0 {4, 4, 0, 0};
+   const std::array<std::uint8_t, 4> expected1 {3, 1, 1, 5};
+
+   auto level0 = packet->level(0);
+   auto level1 = packet->level(1);
+
+   EXPECT_EQ(std::ranges::equal(level0, expected0), true);
+   EXPECT_EQ(std::ranges::equal(level1, expected1), true);
+
+   // Radials are stored contiguously
+   EXPECT_EQ(level1.data(), level0.data() + level0.size());
+}
+
+TEST(RadialDataPacket, BulkAccessors)
+{
+   std::string data {};
+
+   // Packet code, first bin, bins, i, j, scale factor, radials
+   AppendHalfwords(data, {0xAF1F, 0, 2, 0, 0, 1000, 3});
+
+   // Radials: RLE halfwords, start angle, delta angle, data
+   AppendHalfwords(data, {1, 3595, 10, 0x1200});
+   AppendHalfwords(data, {1, 5, 10, 0x2300});
+   AppendHalfwords(data, {1, 15, 12, 0x1411});
+
+   std::istringstream is {data};
+   auto               packet = RadialDataPacket::Create(is);
+
+   ASSERT_NE(packet, nullptr);
+
+   auto startAngles = packet->start_angles();
+   auto deltaAngles = packet->delta_angles();
+   auto levels      = packet->levels();
+
+   ASSERT_EQ(startAngles.size(), 3u);
+   ASSERT_EQ(deltaAngles.size(), 3u);
+   EXPECT_FLOAT_EQ(startAngles[0], 359.5f);
+   EXPECT_FLOAT_EQ(startAngles[2], 1.5f);
+   EXPECT_FLOAT_EQ(deltaAngles[2], 1.2f);
+   EXPECT_EQ(startAngles[1], packet->start_angle(1));
+   EXPECT_EQ(deltaAngles[1], packet->delta_angle(1));
+
+   // Levels are a radials × bins matrix
+   const std::array<std::uint8_t, 6> expected {2, 0, 3, 3, 4, 1};
+   EXPECT_EQ(std::ranges::equal(levels, expected), true);
+   EXPECT_EQ(levels.data(), packet->level(0).data());
+}
+
+} // namespace rpg
+} // namespace wsr88d
+} // namespace scwx
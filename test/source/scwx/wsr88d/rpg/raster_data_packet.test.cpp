@@ -0,0 +1,64 @@
+#include <scwx/wsr88d/rpg/raster_data_packet.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rpg
+{
+
+static void AppendHalfwords(std::string&                        data,
+                            std::initializer_list<std::uint16_t> halfwords)
+{
+   for (std::uint16_t halfword : halfwords)
+   {
+      data.push_back(static_cast<char>(halfword >> 8));
+      data.push_back(static_cast<char>(halfword & 0xff));
+   }
+}
+
+TEST(RasterDataPacket, RunLengthDecode)
+{
+   std::string data {};
+
+   // Packet code, op flags, i, j, x scale, y scale, rows, packaging
+   AppendHalfwords(data, {0xBA0F, 0x8000, 0x00C0, 0, 0, 1, 0, 1, 0, 2, 2});
+
+   // Row 1: 3 bins of level 1, and a zero pad byte
+   AppendHalfwords(data, {2, 0x3100});
+
+   // Row 2: 1 bin of level 2, 2 bins of level 3, 1 bin of level 4
+   AppendHalfwords(data, {4, 0x1223, 0x1400});
+
+   std::istringstream is {data};
+   auto               packet = RasterDataPacket::Create(is);
+
+   ASSERT_NE(packet, nullptr);
+   ASSERT_EQ(packet->number_of_rows(), 2u);
+   EXPECT_EQ(packet->number_of_columns(), 4u);
+
+   const std::array<std::uint8_t, 3> expected0 {1, 1, 1};
+   const std::array<std::uint8_t, 4> expected1 {2, 3, 3, 4};
+
+   auto level0 = packet->level(0);
+   auto level1 = packet->level(1);
+
+   EXPECT_EQ(std::ranges::equal(level0, expected0), true);
+   EXPECT_EQ(std::ranges::equal(level1, expected1), true);
+
+   // Rows are stored in a matrix with a stride of the number of columns
+   EXPECT_EQ(level1.data(), level0.data() + packet->number_of_columns());
+}
+
+} // namespace rpg
+} // namespace wsr88d
+} // namespace scwx
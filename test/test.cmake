@@ -27,14 +27,28 @@ set(SRC_QT_MAP_TESTS source/scwx/qt/map/map_provider.test.cpp)
 set(SRC_QT_MODEL_TESTS source/scwx/qt/model/imgui_context_model.test.cpp)
 set(SRC_QT_SETTINGS_TESTS source/scwx/qt/settings/settings_container.test.cpp
                           source/scwx/qt/settings/settings_variable.test.cpp)
-set(SRC_QT_UTIL_TESTS source/scwx/qt/util/q_file_input_stream.test.cpp)
-set(SRC_UTIL_TESTS source/scwx/util/float.test.cpp
+set(SRC_QT_UTIL_TESTS source/scwx/qt/util/polar_coordinate_cache.test.cpp
+                      source/scwx/qt/util/q_file_input_stream.test.cpp
+                      source/scwx/qt/util/radial_projector.test.cpp
+                      source/scwx/qt/util/raster_coordinate_cache.test.cpp)
+set(HDR_QT_VIEW_TESTS source/scwx/qt/view/radial_sweep_data.hpp)
+set(SRC_QT_VIEW_TESTS source/scwx/qt/view/radar_mesh.test.cpp
+                      source/scwx/qt/view/radial_sweep.test.cpp)
+set(SRC_UTIL_TESTS source/scwx/util/arenabuf.test.cpp
+                   source/scwx/util/binary.test.cpp
+                   source/scwx/util/compression.test.cpp
+                   source/scwx/util/float.test.cpp
                    source/scwx/util/rangebuf.test.cpp
+                   source/scwx/util/run_length.test.cpp
                    source/scwx/util/streams.test.cpp
                    source/scwx/util/vectorbuf.test.cpp)
 set(SRC_WSR88D_TESTS source/scwx/wsr88d/ar2v_file.test.cpp
                      source/scwx/wsr88d/level3_file.test.cpp
                      source/scwx/wsr88d/nexrad_file_factory.test.cpp)
+set(SRC_WSR88D_RPG_TESTS source/scwx/wsr88d/rpg/packet_factory.test.cpp
+                         source/scwx/wsr88d/rpg/product_symbology_block.test.cpp
+                         source/scwx/wsr88d/rpg/radial_data_packet.test.cpp
+                         source/scwx/wsr88d/rpg/raster_data_packet.test.cpp)
 
 set(CMAKE_FILES test.cmake)
 
@@ -49,8 +63,11 @@ add_executable(wxtest ${SRC_MAIN}
                       ${SRC_QT_MODEL_TESTS}
                       ${SRC_QT_SETTINGS_TESTS}
                       ${SRC_QT_UTIL_TESTS}
+                      ${HDR_QT_VIEW_TESTS}
+                      ${SRC_QT_VIEW_TESTS}
                       ${SRC_UTIL_TESTS}
                       ${SRC_WSR88D_TESTS}
+                      ${SRC_WSR88D_RPG_TESTS}
                       ${CMAKE_FILES})
 
 source_group("Source Files\\main"         FILES ${SRC_MAIN})
@@ -64,10 +81,14 @@ source_group("Source Files\\qt\\map"      FILES ${SRC_QT_MAP_TESTS})
 source_group("Source Files\\qt\\model"    FILES ${SRC_QT_MODEL_TESTS})
 source_group("Source Files\\qt\\settings" FILES ${SRC_QT_SETTINGS_TESTS})
 source_group("Source Files\\qt\\util"     FILES ${SRC_QT_UTIL_TESTS})
+source_group("Header Files\\qt\\view"     FILES ${HDR_QT_VIEW_TESTS})
+source_group("Source Files\\qt\\view"     FILES ${SRC_QT_VIEW_TESTS})
 source_group("Source Files\\util"         FILES ${SRC_UTIL_TESTS})
 source_group("Source Files\\wsr88d"       FILES ${SRC_WSR88D_TESTS})
+source_group("Source Files\\wsr88d\\rpg"  FILES ${SRC_WSR88D_RPG_TESTS})
 
-target_include_directories(wxtest PRIVATE ${GTest_INCLUDE_DIRS})
+target_include_directories(wxtest PRIVATE ${GTest_INCLUDE_DIRS}
+                                          ${SCWX_DIR}/test/source)
 
 set_target_properties(wxtest PROPERTIES CXX_STANDARD 20
                                         CXX_STANDARD_REQUIRED ON
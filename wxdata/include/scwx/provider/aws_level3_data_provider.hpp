@@ -1,6 +1,10 @@
 #pragma once
 
 #include <scwx/provider/aws_nexrad_data_provider.hpp>
+#include <scwx/wsr88d/level3_file.hpp>
+
+#include <optional>
+#include <vector>
 
 namespace scwx
 {
@@ -36,6 +40,18 @@ public:
    void                     RequestAvailableProducts();
    std::vector<std::string> GetAvailableProducts();
 
+   /**
+    * @brief Reads summaries of multiple Level 3 objects in parallel. Only the
+    * beginning of each object is requested, and the object size is taken
+    * from the response.
+    *
+    * @param [in] keys Level 3 object keys
+    *
+    * @return Product summaries, in the same order as the keys
+    */
+   std::vector<std::optional<wsr88d::Level3ProductSummary>>
+   LoadSummariesByKey(const std::vector<std::string>& keys);
+
 protected:
    std::string GetPrefix(std::chrono::system_clock::time_point date);
 
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <istream>
+#include <limits>
+#include <memory>
+#include <span>
+#include <streambuf>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Read-only stream buffer over a range of a shared arena. Parsers may
+ * obtain a pointer to the current read position in order to reference data
+ * in place, rather than copying it out of the stream.
+ */
+class arenabuf : public std::streambuf
+{
+public:
+   arenabuf(std::shared_ptr<std::vector<char>> arena,
+            std::size_t                        offset,
+            std::size_t                        size);
+   ~arenabuf() = default;
+
+   arenabuf(const arenabuf&)            = delete;
+   arenabuf& operator=(const arenabuf&) = delete;
+
+   std::shared_ptr<std::vector<char>> arena() const;
+   char*                              current() const;
+
+protected:
+   pos_type seekoff(off_type                off,
+                    std::ios_base::seekdir  way,
+                    std::ios_base::openmode which = std::ios_base::in |
+                                                    std::ios_base::out) override;
+   pos_type seekpos(pos_type                pos,
+                    std::ios_base::openmode which = std::ios_base::in |
+                                                    std::ios_base::out) override;
+
+private:
+   std::shared_ptr<std::vector<char>> arena_;
+};
+
+/**
+ * @brief Reads up to size bytes from the stream, and advances the stream past
+ * them. If the stream is backed by an arena, the data is referenced in place.
+ * Otherwise, the data is read into the buffer. By default, the remainder of
+ * the stream is read.
+ *
+ * @param [in,out] is Input stream
+ * @param [out] buffer Storage for data which cannot be referenced in place
+ * @param [in] size Maximum number of bytes to read
+ *
+ * @return Data read from the stream, valid while the arena or buffer exists
+ */
+std::span<const char>
+ReadInPlace(std::istream&      is,
+            std::vector<char>& buffer,
+            std::size_t        size = std::numeric_limits<std::size_t>::max());
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <span>
+#include <type_traits>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Writes trivially copyable values to a stream in host byte order.
+ * Arrays are aligned to BinaryWriter::ALIGNMENT bytes relative to the start
+ * of the stream, so they may be referenced in place when read back from an
+ * aligned buffer (e.g., a memory-mapped file).
+ */
+class BinaryWriter
+{
+public:
+   explicit BinaryWriter(std::ostream& os);
+   ~BinaryWriter() = default;
+
+   BinaryWriter(const BinaryWriter&)            = delete;
+   BinaryWriter& operator=(const BinaryWriter&) = delete;
+
+   template<class T>
+   void Write(const T& value)
+   {
+      static_assert(std::is_trivially_copyable_v<T>);
+      WriteBytes(reinterpret_cast<const char*>(&value), sizeof(T));
+   }
+
+   template<class T>
+   void WriteArray(std::span<const T> values)
+   {
+      static_assert(std::is_trivially_copyable_v<T>);
+      Align();
+      WriteBytes(reinterpret_cast<const char*>(values.data()),
+                 values.size_bytes());
+   }
+
+   void Align();
+   bool good() const;
+
+   static constexpr std::size_t ALIGNMENT = 8u;
+
+private:
+   void WriteBytes(const char* data, std::size_t size);
+
+   std::ostream& os_;
+   std::size_t   position_;
+};
+
+/**
+ * @brief Reads values written by BinaryWriter from a buffer. Arrays are
+ * referenced in place. Reads past the end of the buffer fail, and leave the
+ * reader in a failed state.
+ */
+class BinaryReader
+{
+public:
+   explicit BinaryReader(std::span<const char> data);
+   ~BinaryReader() = default;
+
+   BinaryReader(const BinaryReader&)            = delete;
+   BinaryReader& operator=(const BinaryReader&) = delete;
+
+   template<class T>
+   bool Read(T& value)
+   {
+      static_assert(std::is_trivially_copyable_v<T>);
+      const char* data = ReadBytes(sizeof(T));
+      if (data != nullptr)
+      {
+         std::memcpy(&value, data, sizeof(T));
+      }
+      return data != nullptr;
+   }
+
+   template<class T>
+   bool ReadArray(std::size_t count, std::span<const T>& values)
+   {
+      static_assert(std::is_trivially_copyable_v<T>);
+      Align();
+      if (count > data_.size() / sizeof(T))
+      {
+         good_ = false;
+         return false;
+      }
+      const char* data = ReadBytes(count * sizeof(T));
+      if (data != nullptr)
+      {
+         values = {reinterpret_cast<const T*>(data), count};
+      }
+      return data != nullptr;
+   }
+
+   void Align();
+   bool good() const;
+
+private:
+   const char* ReadBytes(std::size_t size);
+
+   std::span<const char> data_;
+   std::size_t           position_;
+   bool                  good_;
+};
+
+} // namespace util
+} // namespace scwx
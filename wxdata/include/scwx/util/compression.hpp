@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Decompresses a bzip2 stream directly from the input buffer, and
+ * appends the decompressed data to the output buffer. The output buffer is
+ * grown only if its reserved capacity is exhausted.
+ *
+ * @param [in] input Compressed data
+ * @param [in,out] output Decompressed data
+ *
+ * @return true if a complete bzip2 stream was decompressed
+ */
+bool DecompressBzip2(std::span<const char> input, std::vector<char>& output);
+
+/**
+ * @brief Decompresses the beginning of a bzip2 stream, until size bytes have
+ * been appended to the output buffer or the stream ends. This is used to read
+ * headers without decompressing the remainder of the stream.
+ *
+ * @param [in] input Compressed data
+ * @param [in,out] output Decompressed data
+ * @param [in] size Maximum number of bytes to decompress
+ *
+ * @return true if size bytes, or a complete bzip2 stream, were decompressed
+ */
+bool DecompressBzip2Prefix(std::span<const char> input,
+                           std::vector<char>&    output,
+                           std::size_t           size);
+
+/**
+ * @brief Decompresses a single zlib stream directly from the input buffer,
+ * and appends the decompressed data to the output buffer. Data following the
+ * end of the zlib stream is not consumed.
+ *
+ * @param [in] input Compressed data
+ * @param [in,out] output Decompressed data
+ * @param [out] bytesConsumed Number of bytes of input consumed
+ *
+ * @return true if a complete zlib stream was decompressed
+ */
+bool DecompressZlib(std::span<const char> input,
+                    std::vector<char>&    output,
+                    std::size_t&          bytesConsumed);
+
+/**
+ * @brief Decompresses the beginning of a zlib stream, until size bytes have
+ * been appended to the output buffer or the stream ends. This is used to read
+ * headers without decompressing the remainder of the stream.
+ *
+ * @param [in] input Compressed data
+ * @param [in,out] output Decompressed data
+ * @param [in] size Maximum number of bytes to decompress
+ *
+ * @return true if size bytes, or a complete zlib stream, were decompressed
+ */
+bool DecompressZlibPrefix(std::span<const char> input,
+                          std::vector<char>&    output,
+                          std::size_t           size);
+
+/**
+ * @brief Decompresses a single gzip member directly from the input buffer,
+ * and appends the decompressed data to the output buffer. Data following the
+ * end of the gzip member, such as additional members, is not consumed.
+ *
+ * @param [in] input Compressed data
+ * @param [in,out] output Decompressed data
+ * @param [out] bytesConsumed Number of bytes of input consumed
+ *
+ * @return true if a complete gzip member was decompressed
+ */
+bool DecompressGzip(std::span<const char> input,
+                    std::vector<char>&    output,
+                    std::size_t&          bytesConsumed);
+
+} // namespace util
+} // namespace scwx
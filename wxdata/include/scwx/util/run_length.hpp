@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Decodes run-length encoded data, in which each byte contains a
+ * 4-bit run in the upper nibble and a 4-bit value in the lower nibble (e.g.,
+ * Level 3 radial and raster data packets). Decoding stops when the output is
+ * full. Bytes with a run of 0 decode to nothing. Output values following
+ * the decoded values are set to 0.
+ *
+ * @param [in] data Run-length encoded data
+ * @param [out] output Decoded values
+ *
+ * @return Number of values decoded
+ */
+std::size_t DecodeRunLength(std::span<const std::uint8_t> data,
+                            std::span<std::uint8_t>       output);
+
+/**
+ * @brief Counts the values contained in run-length encoded data, i.e., the
+ * sum of the runs.
+ */
+std::size_t CountRunLength(std::span<const std::uint8_t> data);
+
+/**
+ * @brief Scalar implementations of DecodeRunLength and CountRunLength, used
+ * when SIMD instructions are not available. The results of the scalar and
+ * SIMD implementations are identical.
+ */
+std::size_t DecodeRunLengthScalar(std::span<const std::uint8_t> data,
+                                  std::span<std::uint8_t>       output);
+std::size_t CountRunLengthScalar(std::span<const std::uint8_t> data);
+
+} // namespace util
+} // namespace scwx
@@ -1,12 +1,17 @@
 #pragma once
 
 #include <scwx/wsr88d/nexrad_file.hpp>
-#include <scwx/wsr88d/rda/digital_radar_data.hpp>
+#include <scwx/wsr88d/rda/packed_elevation_scan.hpp>
+#include <scwx/wsr88d/rda/types.hpp>
 #include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
 
 #include <chrono>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
+#include <vector>
 
 namespace scwx
 {
@@ -15,6 +20,44 @@ namespace wsr88d
 
 class Ar2vFileImpl;
 
+/**
+ * @brief Summary of a single elevation cut, read from its first radial.
+ */
+struct Ar2vElevationCutSummary
+{
+   std::uint16_t                         elevationIndex_ {0};
+   float                                 elevationAngle_ {0.0f};
+   std::chrono::system_clock::time_point startTime_ {};
+   std::vector<rda::DataBlockType>       moments_ {};
+};
+
+/**
+ * @brief Summary of an Archive II volume, suitable for building catalogs
+ * without decoding the volume.
+ */
+struct Ar2vVolumeSummary
+{
+   std::string                           icao_ {};
+   std::chrono::system_clock::time_point startTime_ {};
+   std::uint16_t                         volumeCoveragePattern_ {0};
+   std::vector<Ar2vElevationCutSummary>  elevationCuts_ {};
+};
+
+/**
+ * @brief Options controlling how an Archive II volume is loaded.
+ */
+struct Ar2vLoadOptions
+{
+   /**
+    * @brief Message types which are decoded during the load. Other messages
+    * are retained undecoded, and metadata messages are decoded when requested
+    * using GetMetadataMessage. The VCP and Digital Radar Data are always
+    * decoded.
+    */
+   std::set<rda::MessageId> eagerMessageTypes_ {
+      rda::MessageId::DigitalRadarData};
+};
+
 /**
  * @brief The Archive II file is specified in the Interface Control Document for
  * the Archive II/User, Document Number 2620010H, published by the WSR-88D Radar
@@ -32,6 +75,9 @@ public:
    Ar2vFile(Ar2vFile&&) noexcept;
    Ar2vFile& operator=(Ar2vFile&&) noexcept;
 
+   typedef std::function<void(std::uint16_t elevationIndex, float elevation)>
+      ElevationCompleteCallback;
+
    uint32_t    julian_date() const;
    uint32_t    milliseconds() const;
    std::string icao() const;
@@ -39,17 +85,132 @@ public:
    std::chrono::system_clock::time_point start_time() const;
    std::chrono::system_clock::time_point end_time() const;
 
-   std::map<uint16_t, std::shared_ptr<rda::ElevationScan>> radar_data() const;
-   std::shared_ptr<const rda::VolumeCoveragePatternData>   vcp_data() const;
+   std::shared_ptr<const rda::VolumeCoveragePatternData> vcp_data() const;
+
+   /**
+    * @brief Gets the packed elevation scan closest to the requested elevation
+    * angle. When an elevation angle is scanned more than once in a volume, the
+    * cut closest in time to the requested time is selected. A
+    * default-initialized time selects the latest cut. Radial messages are
+    * released once each elevation cut is packed.
+    *
+    * @param [in] dataBlockType Moment to select
+    * @param [in] elevation Elevation angle in degrees
+    * @param [in] time Requested time
+    *
+    * @return Packed elevation scan, selected elevation cut, and all elevation
+    * cuts containing the moment
+    */
+   std::tuple<std::shared_ptr<rda::PackedElevationScan>,
+              float,
+              std::vector<float>>
+   GetPackedElevationScan(rda::DataBlockType                    dataBlockType,
+                          float                                 elevation,
+                          std::chrono::system_clock::time_point time) const;
+
+   /**
+    * @brief Gets a metadata message (RDA status, performance/maintenance
+    * data, clutter filter maps or RDA adaptation data) from the volume.
+    * Metadata messages are decoded the first time they are requested.
+    *
+    * @param [in] messageId Message type
+    *
+    * @return Decoded message, or nullptr if the volume does not contain the
+    * message
+    */
+   std::shared_ptr<rda::Level2Message>
+   GetMetadataMessage(rda::MessageId messageId) const;
 
-   std::tuple<std::shared_ptr<rda::ElevationScan>, float, std::vector<float>>
-   GetElevationScan(rda::DataBlockType                    dataBlockType,
-                    float                                 elevation,
-                    std::chrono::system_clock::time_point time) const;
+   /**
+    * @brief Reads a summary of an Archive II volume. Only the metadata
+    * record, and the first radial of each subsequent LDM record, are
+    * decompressed and decoded.
+    *
+    * @param [in] is Input stream beginning with the Volume Header Record
+    *
+    * @return Volume summary, or empty if the volume could not be read
+    */
+   static std::optional<Ar2vVolumeSummary> ReadSummary(std::istream& is);
+   static std::optional<Ar2vVolumeSummary>
+   ReadSummaryFile(const std::string& filename);
 
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
 
+   /**
+    * @brief Loads an Archive II volume using the specified load options.
+    *
+    * @param [in] filename Archive II filename
+    * @param [in] options Load options
+    *
+    * @return true if the file was successfully loaded
+    */
+   bool LoadFile(const std::string& filename, const Ar2vLoadOptions& options);
+   bool LoadData(std::istream& is, const Ar2vLoadOptions& options);
+
+   /**
+    * @brief Incrementally loads LDM records, such as those contained in a
+    * real-time chunk file. The first chunk of a volume must begin with the
+    * Volume Header Record. Each elevation cut is made available to
+    * GetPackedElevationScan once its final radial has been received.
+    *
+    * @param [in] is Input stream containing zero or more LDM records
+    * @param [in] options Load options
+    *
+    * @return true if the records were successfully loaded
+    */
+   bool LoadLDMRecords(std::istream& is, const Ar2vLoadOptions& options = {});
+
+   /**
+    * @brief Incrementally loads a real-time chunk file.
+    *
+    * @param [in] filename Chunk filename
+    * @param [in] options Load options
+    *
+    * @return true if the chunk was successfully loaded
+    */
+   bool LoadChunkFile(const std::string&     filename,
+                      const Ar2vLoadOptions& options = {});
+
+   /**
+    * @brief Writes the decoded volume to a cache file, which may be loaded
+    * using LoadCache without decompressing or decoding the volume. Every
+    * moment of every elevation cut is written packed. The cache is written to
+    * a uniquely named temporary file, which is renamed into place once
+    * complete.
+    *
+    * @param [in] filename Cache filename
+    *
+    * @return true if the cache was successfully written
+    */
+   bool WriteCache(const std::string& filename) const;
+
+   /**
+    * @brief Loads a volume from a cache file written by WriteCache. The cache
+    * file is memory-mapped, and packed elevation scans reference it in place.
+    * Volumes loaded from a cache provide the volume header, VCP data and
+    * packed elevation scans. GetMetadataMessage returns nullptr.
+    *
+    * This function does not fall back to the source file. If the cache is
+    * missing, of a different version or malformed, false is returned and the
+    * volume may be partially loaded. The caller should discard it and load
+    * the source file instead.
+    *
+    * @param [in] filename Cache filename
+    *
+    * @return true if the cache was successfully loaded
+    */
+   bool LoadCache(const std::string& filename);
+
+   /**
+    * @brief Sets a callback to be invoked each time an elevation cut is
+    * completed during an incremental load. The callback is invoked on the
+    * loading thread.
+    *
+    * @param [in] callback Elevation complete callback
+    */
+   void SetElevationCompleteCallback(ElevationCompleteCallback callback);
+
 private:
    std::unique_ptr<Ar2vFileImpl> p;
 };
@@ -4,8 +4,13 @@
 #include <scwx/wsr88d/nexrad_file.hpp>
 #include <scwx/wsr88d/rpg/level3_message.hpp>
 
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace scwx
 {
@@ -14,6 +19,21 @@ namespace wsr88d
 
 class Level3FileImpl;
 
+/**
+ * @brief Summary of a Level 3 product, suitable for building product
+ * inventories and timelines without decoding the product.
+ */
+struct Level3ProductSummary
+{
+   std::string                           productCategory_ {};
+   std::string                           productDesignator_ {};
+   std::int16_t                          productCode_ {0};
+   std::uint16_t                         elevationNumber_ {0};
+   std::uint16_t                         volumeCoveragePattern_ {0};
+   std::chrono::system_clock::time_point time_ {};
+   std::size_t                           size_ {0};
+};
+
 class Level3File : public NexradFile
 {
 public:
@@ -29,6 +49,41 @@ public:
    std::shared_ptr<awips::WmoHeader>   wmo_header() const;
    std::shared_ptr<rpg::Level3Message> message() const;
 
+   /**
+    * @brief Reads a summary of a Level 3 product. Parsing stops after the
+    * product description block, and only the beginning of a compressed
+    * product is decompressed. The product time is the volume scan start time
+    * if the product has a description block, otherwise the message time.
+    *
+    * @param [in] is Input stream beginning with the WMO header
+    *
+    * @return Product summary, or empty if the product could not be read
+    */
+   static std::optional<Level3ProductSummary> ReadSummary(std::istream& is);
+   static std::optional<Level3ProductSummary>
+   ReadSummaryFile(const std::string& filename);
+
+   /**
+    * @brief Reads summaries of multiple Level 3 products in parallel.
+    *
+    * @param [in] filenames Level 3 product filenames
+    *
+    * @return Product summaries, in the same order as the filenames
+    */
+   static std::vector<std::optional<Level3ProductSummary>>
+   ReadSummaryFiles(const std::vector<std::string>& filenames);
+
+   /**
+    * @brief Reads summaries of the Level 3 products in a directory in
+    * parallel. Files which are not Level 3 products are omitted.
+    *
+    * @param [in] directory Directory containing Level 3 products
+    *
+    * @return Product summaries, by filename
+    */
+   static std::map<std::string, Level3ProductSummary>
+   ReadSummaryDirectory(const std::string& directory);
+
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
 
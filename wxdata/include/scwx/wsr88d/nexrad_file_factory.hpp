@@ -2,6 +2,8 @@
 
 #include <scwx/wsr88d/nexrad_file.hpp>
 
+#include <cstdint>
+
 namespace scwx
 {
 namespace wsr88d
@@ -21,6 +23,22 @@ private:
 
 public:
    static std::shared_ptr<NexradFile> Create(const std::string& filename);
+
+   /**
+    * @brief Creates a NEXRAD file, using a decoded volume cache for Archive II
+    * files. If the cache directory contains a cache newer than the file, the
+    * cache is loaded. Otherwise, the file is loaded and its cache is written
+    * asynchronously. After a cache is written, the least recently used caches
+    * are removed until the cache directory is within its size limit.
+    *
+    * @param [in] filename NEXRAD filename
+    * @param [in] cacheDirectory Decoded volume cache directory
+    * @param [in] cacheSizeLimit Maximum size of the cache directory in bytes
+    */
+   static std::shared_ptr<NexradFile>
+   Create(const std::string& filename,
+          const std::string& cacheDirectory,
+          std::uintmax_t     cacheSizeLimit);
    static std::shared_ptr<NexradFile> Create(std::istream& is);
 };
 
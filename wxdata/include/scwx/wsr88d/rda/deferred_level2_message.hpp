@@ -0,0 +1,47 @@
+#pragma once
+
+#include <scwx/wsr88d/rda/level2_message.hpp>
+
+#include <span>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+class DeferredLevel2MessageImpl;
+
+/**
+ * @brief A Level II message whose body has not been decoded. The undecoded
+ * message body is retained, and may be decoded on demand using
+ * Level2MessageFactory::Decode. When parsed from an arena, the message body
+ * references the arena in place.
+ */
+class DeferredLevel2Message : public Level2Message
+{
+public:
+   explicit DeferredLevel2Message();
+   ~DeferredLevel2Message();
+
+   DeferredLevel2Message(const DeferredLevel2Message&)            = delete;
+   DeferredLevel2Message& operator=(const DeferredLevel2Message&) = delete;
+
+   DeferredLevel2Message(DeferredLevel2Message&&) noexcept;
+   DeferredLevel2Message& operator=(DeferredLevel2Message&&) noexcept;
+
+   std::span<const char> data() const;
+
+   bool Parse(std::istream& is) override;
+
+   static std::shared_ptr<DeferredLevel2Message>
+   Create(Level2MessageHeader&& header, std::istream& is);
+
+private:
+   std::unique_ptr<DeferredLevel2MessageImpl> p;
+};
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -3,6 +3,8 @@
 #include <scwx/util/iterator.hpp>
 #include <scwx/wsr88d/rda/level2_message.hpp>
 
+#include <span>
+
 namespace scwx
 {
 namespace wsr88d
@@ -105,6 +107,15 @@ public:
    float       offset() const;
    const void* data_moments() const;
 
+   std::span<const uint8_t>  data_moments8() const;
+   std::span<const uint16_t> data_moments16() const;
+
+   /**
+    * @brief Arena referenced by the data moments, or nullptr if the data
+    * moments are owned by the block.
+    */
+   std::shared_ptr<const std::vector<char>> arena() const;
+
    static std::shared_ptr<MomentDataBlock>
    Create(const std::string& dataBlockType,
           const std::string& dataName,
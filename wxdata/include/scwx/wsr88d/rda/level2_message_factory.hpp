@@ -1,6 +1,9 @@
 #pragma once
 
 #include <scwx/wsr88d/rda/level2_message.hpp>
+#include <scwx/wsr88d/rda/types.hpp>
+
+#include <set>
 
 namespace scwx
 {
@@ -37,8 +40,30 @@ public:
    struct Context;
 
    static std::shared_ptr<Context> CreateContext();
-   static Level2MessageInfo        Create(std::istream&            is,
-                                          std::shared_ptr<Context> ctx);
+
+   /**
+    * @brief Creates a context which only parses the listed message types.
+    * Other messages are created as a DeferredLevel2Message, retaining the
+    * undecoded message body.
+    *
+    * @param [in] eagerMessageTypes Message types to parse eagerly
+    */
+   static std::shared_ptr<Context>
+   CreateContext(const std::set<MessageId>& eagerMessageTypes);
+
+   static Level2MessageInfo Create(std::istream&            is,
+                                   std::shared_ptr<Context> ctx);
+
+   /**
+    * @brief Decodes a deferred message. Messages which have already been
+    * decoded are returned as-is.
+    *
+    * @param [in] message Level II message
+    *
+    * @return Decoded message, or nullptr if the message could not be decoded
+    */
+   static std::shared_ptr<Level2Message>
+   Decode(std::shared_ptr<Level2Message> message);
 };
 
 } // namespace rda
@@ -18,8 +18,8 @@ public:
    explicit Level2MessageHeader();
    ~Level2MessageHeader();
 
-   Level2MessageHeader(const Level2MessageHeader&) = delete;
-   Level2MessageHeader& operator=(const Level2MessageHeader&) = delete;
+   Level2MessageHeader(const Level2MessageHeader&);
+   Level2MessageHeader& operator=(const Level2MessageHeader&);
 
    Level2MessageHeader(Level2MessageHeader&&) noexcept;
    Level2MessageHeader& operator=(Level2MessageHeader&&) noexcept;
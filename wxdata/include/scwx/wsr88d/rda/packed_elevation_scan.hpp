@@ -0,0 +1,94 @@
+#pragma once
+
+#include <scwx/util/binary.hpp>
+#include <scwx/wsr88d/rda/digital_radar_data.hpp>
+
+#include <chrono>
+#include <memory>
+#include <span>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+class PackedElevationScanImpl;
+
+/**
+ * @brief An elevation scan stored as a structure of arrays. Each moment is
+ * stored as a contiguous radials × gates matrix, with contiguous per-radial
+ * range metadata. Radials are stored in azimuth number order. Moment matrices
+ * are copied when the scan is created, and do not reference the parsed radials.
+ */
+class PackedElevationScan
+{
+public:
+   explicit PackedElevationScan();
+   ~PackedElevationScan();
+
+   PackedElevationScan(const PackedElevationScan&)            = delete;
+   PackedElevationScan& operator=(const PackedElevationScan&) = delete;
+
+   PackedElevationScan(PackedElevationScan&&) noexcept;
+   PackedElevationScan& operator=(PackedElevationScan&&) noexcept;
+
+   std::size_t                           radial_count() const;
+   std::span<const float>                azimuth_angles() const;
+   float                                 latitude() const;
+   float                                 longitude() const;
+   std::uint16_t                         volume_coverage_pattern_number() const;
+   std::chrono::system_clock::time_point start_time() const;
+
+   bool has_moment(DataBlockType type) const;
+
+   /**
+    * @brief Number of gates in each row of the moment data matrix. This is
+    * the maximum number of data moment gates of any radial.
+    */
+   std::uint16_t gate_stride(DataBlockType type) const;
+   std::uint8_t  data_word_size(DataBlockType type) const;
+   float         scale(DataBlockType type) const;
+   float         offset(DataBlockType type) const;
+   std::int16_t  snr_threshold_raw(DataBlockType type) const;
+
+   std::span<const std::uint16_t>
+   number_of_data_moment_gates(DataBlockType type) const;
+   std::span<const std::uint16_t>
+   data_moment_range_raw(DataBlockType type) const;
+   std::span<const std::uint16_t>
+   data_moment_range_sample_interval_raw(DataBlockType type) const;
+
+   std::span<const std::uint8_t>  data_moments8(DataBlockType type) const;
+   std::span<const std::uint16_t> data_moments16(DataBlockType type) const;
+
+   /**
+    * @brief Size in bytes of the resident moment data matrix.
+    */
+   std::size_t packed_size(DataBlockType type) const;
+
+   static std::shared_ptr<PackedElevationScan>
+   Create(const ElevationScan& elevationScan);
+
+   /**
+    * @brief Writes the scan, with every moment, to a binary cache.
+    */
+   void Write(util::BinaryWriter& writer) const;
+
+   /**
+    * @brief Reads a scan written by Write. The moment arrays reference the
+    * reader's buffer in place, which is kept alive by storage.
+    *
+    * @return Packed elevation scan, or nullptr if the buffer is malformed
+    */
+   static std::shared_ptr<PackedElevationScan>
+   Read(util::BinaryReader& reader, std::shared_ptr<const void> storage);
+
+private:
+   std::unique_ptr<PackedElevationScanImpl> p;
+};
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace scwx
 {
 namespace wsr88d
@@ -12,11 +14,22 @@ enum class MessageId : uint8_t
    RdaStatusData              = 2,
    PerformanceMaintenanceData = 3,
    VolumeCoveragePatternData  = 5,
+   ClutterFilterBypassMap     = 13,
    ClutterFilterMap           = 15,
    RdaAdaptationData          = 18,
    DigitalRadarData           = 31
 };
 
+enum class RadialStatus : uint8_t
+{
+   BeginningOfElevation     = 0,
+   Intermediate             = 1,
+   EndOfElevation           = 2,
+   BeginningOfVolume        = 3,
+   EndOfVolume              = 4,
+   BeginningOfLastElevation = 5
+};
+
 } // namespace rda
 } // namespace wsr88d
 } // namespace scwx
@@ -36,9 +36,25 @@ public:
    float    range_scale_factor() const;
    uint16_t number_of_radials() const;
 
-   float                       start_angle(uint16_t r) const;
-   float                       delta_angle(uint16_t r) const;
-   const std::vector<uint8_t>& level(uint16_t r) const;
+   float                    start_angle(uint16_t r) const;
+   float                    delta_angle(uint16_t r) const;
+   std::span<const uint8_t> level(uint16_t r) const;
+
+   /**
+    * @brief Start angle of each radial in degrees, indexed by radial.
+    */
+   std::span<const float> start_angles() const;
+
+   /**
+    * @brief Delta angle of each radial in degrees, indexed by radial.
+    */
+   std::span<const float> delta_angles() const;
+
+   /**
+    * @brief Levels of all radials as a contiguous, row-major matrix of
+    * number_of_radials() × number_of_range_bins().
+    */
+   std::span<const uint8_t> levels() const;
 
    size_t data_size() const override;
 
@@ -30,6 +30,11 @@ public:
    uint16_t                packet_code() const override;
    uint16_t                length_of_block() const;
    std::optional<uint16_t> value_of_vector() const;
+   int16_t                 start_i() const;
+   int16_t                 start_j() const;
+   int16_t                 end_i(size_t v) const;
+   int16_t                 end_j(size_t v) const;
+   size_t                  vector_count() const;
 
    size_t data_size() const override;
 
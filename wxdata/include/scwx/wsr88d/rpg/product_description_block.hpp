@@ -62,7 +62,8 @@ public:
    float log_offset() const;
    float log_scale() const;
 
-   bool IsCompressionEnabled() const;
+   bool     IsCompressionEnabled() const;
+   uint32_t uncompressed_size() const;
 
    size_t data_size() const override;
 
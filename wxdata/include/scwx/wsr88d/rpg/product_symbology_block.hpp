@@ -5,6 +5,8 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace scwx
 {
@@ -13,6 +15,9 @@ namespace wsr88d
 namespace rpg
 {
 
+class DigitalRadialDataArrayPacket;
+class RadialDataPacket;
+class RasterDataPacket;
 class ProductSymbologyBlockImpl;
 
 class ProductSymbologyBlock : public awips::Message
@@ -30,7 +35,23 @@ public:
    int16_t  block_divider() const;
    uint16_t number_of_layers() const;
 
-   std::vector<std::shared_ptr<Packet>> packet_list(uint16_t i) const;
+   const std::vector<std::shared_ptr<Packet>>& packet_list(uint16_t i) const;
+
+   /**
+    * @brief Gets all packets with the specified packet code, in the order they
+    * appear in the layers. Each packet code is created as a single packet
+    * class, so the packets may be converted using std::static_pointer_cast.
+    */
+   std::span<const std::shared_ptr<Packet>> packets(uint16_t packetCode) const;
+
+   /**
+    * @brief Gets the first packet of the specified type in any layer, or
+    * nullptr if the block does not contain the packet.
+    */
+   std::shared_ptr<DigitalRadialDataArrayPacket>
+                                     digital_radial_data_array_packet() const;
+   std::shared_ptr<RadialDataPacket> radial_data_packet() const;
+   std::shared_ptr<RasterDataPacket> raster_data_packet() const;
 
    size_t data_size() const override;
 
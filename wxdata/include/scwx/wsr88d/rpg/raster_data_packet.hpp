@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 
 namespace scwx
 {
@@ -37,7 +38,13 @@ public:
    uint16_t number_of_rows() const;
    uint16_t packaging_descriptor() const;
 
-   const std::vector<uint8_t>& level(uint16_t r) const;
+   /**
+    * @brief Number of columns in the level matrix. This is the maximum number
+    * of bins of any row.
+    */
+   uint16_t number_of_columns() const;
+
+   std::span<const uint8_t> level(uint16_t r) const;
 
    size_t data_size() const override;
 
@@ -28,6 +28,12 @@ public:
 
    uint16_t packet_code() const override;
    uint16_t length_of_block() const;
+   uint16_t value(size_t i) const;
+   int16_t  x_coordinate(size_t i) const;
+   int16_t  y_coordinate(size_t i) const;
+   uint16_t direction_of_wind(size_t i) const;
+   uint16_t wind_speed(size_t i) const;
+   size_t   RecordCount() const;
 
    size_t data_size() const override;
 
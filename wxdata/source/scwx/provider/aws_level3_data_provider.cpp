@@ -3,8 +3,12 @@
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <charconv>
+#include <execution>
 #include <shared_mutex>
 
+#include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/ListObjectsV2Request.h>
 #include <fmt/chrono.h>
 #include <fmt/format.h>
@@ -25,6 +29,10 @@ static const auto logger_ = util::Logger::Create(logPrefix_);
 static const std::string kDefaultBucketName_ = "unidata-nexrad-level3";
 static const std::string kDefaultRegion_     = "us-east-1";
 
+// Object range requested for a summary, which contains the headers and
+// product description block
+static constexpr std::size_t kSummaryRangeSize_ = 4096u;
+
 static std::unordered_map<std::string, std::vector<std::string>> productMap_;
 static std::shared_mutex                                         productMutex_;
 
@@ -46,6 +54,9 @@ public:
 
    void ListProducts();
 
+   std::optional<wsr88d::Level3ProductSummary>
+   LoadSummaryByKey(const std::string& key);
+
    AwsLevel3DataProvider* self_;
 
    std::string radarSite_;
@@ -148,6 +159,60 @@ std::vector<std::string> AwsLevel3DataProvider::GetAvailableProducts()
    return {};
 }
 
+std::vector<std::optional<wsr88d::Level3ProductSummary>>
+AwsLevel3DataProvider::LoadSummariesByKey(const std::vector<std::string>& keys)
+{
+   std::vector<std::optional<wsr88d::Level3ProductSummary>> summaries(
+      keys.size());
+
+   std::transform(std::execution::par,
+                  keys.cbegin(),
+                  keys.cend(),
+                  summaries.begin(),
+                  [this](const std::string& key)
+                  { return p->LoadSummaryByKey(key); });
+
+   return summaries;
+}
+
+std::optional<wsr88d::Level3ProductSummary>
+AwsLevel3DataProvider::Impl::LoadSummaryByKey(const std::string& key)
+{
+   std::optional<wsr88d::Level3ProductSummary> summary {};
+
+   Aws::S3::Model::GetObjectRequest request;
+   request.SetBucket(bucketName_);
+   request.SetKey(key);
+   request.SetRange(fmt::format("bytes=0-{}", kSummaryRangeSize_ - 1u));
+
+   auto outcome = self_->client()->GetObject(request);
+
+   if (outcome.IsSuccess())
+   {
+      auto& result = outcome.GetResultWithOwnership();
+
+      summary = wsr88d::Level3File::ReadSummary(result.GetBody());
+
+      // Content range format: bytes 0-4095/12345
+      const auto&  contentRange = result.GetContentRange();
+      const size_t sizeOffset   = contentRange.rfind('/');
+
+      if (summary.has_value() && sizeOffset != std::string::npos)
+      {
+         std::from_chars(contentRange.data() + sizeOffset + 1,
+                         contentRange.data() + contentRange.size(),
+                         summary->size_);
+      }
+   }
+   else
+   {
+      logger_->warn("Could not get object: {}",
+                    outcome.GetError().GetMessage());
+   }
+
+   return summary;
+}
+
 void AwsLevel3DataProvider::Impl::ListProducts()
 {
    std::shared_lock readLock(productMutex_);
@@ -0,0 +1,119 @@
+#include <scwx/util/arenabuf.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace scwx
+{
+namespace util
+{
+
+arenabuf::arenabuf(std::shared_ptr<std::vector<char>> arena,
+                   std::size_t                        offset,
+                   std::size_t                        size) :
+    arena_ {std::move(arena)}
+{
+   char* begin = arena_->data() + offset;
+   setg(begin, begin, begin + size);
+}
+
+std::shared_ptr<std::vector<char>> arenabuf::arena() const
+{
+   return arena_;
+}
+
+char* arenabuf::current() const
+{
+   return gptr();
+}
+
+arenabuf::pos_type arenabuf::seekoff(off_type                off,
+                                     std::ios_base::seekdir  way,
+                                     std::ios_base::openmode which)
+{
+   if ((which & std::ios_base::in) == 0)
+   {
+      return pos_type(off_type(-1));
+   }
+
+   off_type base;
+   switch (way)
+   {
+   case std::ios_base::beg:
+      base = 0;
+      break;
+   case std::ios_base::cur:
+      base = gptr() - eback();
+      break;
+   case std::ios_base::end:
+      base = egptr() - eback();
+      break;
+   default:
+      return pos_type(off_type(-1));
+   }
+
+   const off_type newOffset = base + off;
+   if (newOffset < 0 || newOffset > egptr() - eback())
+   {
+      return pos_type(off_type(-1));
+   }
+
+   setg(eback(), eback() + newOffset, egptr());
+
+   return pos_type(newOffset);
+}
+
+arenabuf::pos_type arenabuf::seekpos(pos_type                pos,
+                                     std::ios_base::openmode which)
+{
+   return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+std::span<const char>
+ReadInPlace(std::istream& is, std::vector<char>& buffer, std::size_t size)
+{
+   arenabuf* arena = dynamic_cast<arenabuf*>(is.rdbuf());
+
+   if (arena != nullptr && is.good())
+   {
+      const std::size_t available =
+         static_cast<std::size_t>(std::max<std::streamsize>(
+            arena->in_avail(), 0));
+      const std::size_t bytesRead = std::min(size, available);
+
+      std::span<const char> data {arena->current(), bytesRead};
+      is.seekg(static_cast<std::streamoff>(bytesRead), std::ios_base::cur);
+      return data;
+   }
+
+   // Determine the size of the remainder of the stream, if it is seekable
+   const std::streampos dataStart = is.tellg();
+   is.seekg(0, std::ios_base::end);
+   const std::streamoff dataSize = is.tellg() - dataStart;
+   is.seekg(dataStart, std::ios_base::beg);
+
+   if (dataStart >= 0 && dataSize >= 0)
+   {
+      buffer.resize(std::min(size, static_cast<std::size_t>(dataSize)));
+      is.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      buffer.resize(static_cast<std::size_t>(is.gcount()));
+   }
+   else
+   {
+      // The stream is not seekable
+      is.clear();
+      buffer.clear();
+
+      std::istreambuf_iterator<char> it {is};
+      std::istreambuf_iterator<char> end {};
+      for (; it != end && buffer.size() < size; ++it)
+      {
+         buffer.push_back(*it);
+      }
+   }
+
+   return buffer;
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,69 @@
+#include <scwx/util/binary.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+BinaryWriter::BinaryWriter(std::ostream& os) : os_ {os}, position_ {0} {}
+
+void BinaryWriter::Align()
+{
+   static constexpr char padding[ALIGNMENT] = {};
+
+   const std::size_t remainder = position_ % ALIGNMENT;
+   if (remainder != 0)
+   {
+      WriteBytes(padding, ALIGNMENT - remainder);
+   }
+}
+
+bool BinaryWriter::good() const
+{
+   return os_.good();
+}
+
+void BinaryWriter::WriteBytes(const char* data, std::size_t size)
+{
+   os_.write(data, static_cast<std::streamsize>(size));
+   position_ += size;
+}
+
+BinaryReader::BinaryReader(std::span<const char> data) :
+    data_ {data}, position_ {0}, good_ {true}
+{
+}
+
+void BinaryReader::Align()
+{
+   const std::size_t remainder = position_ % BinaryWriter::ALIGNMENT;
+   if (remainder != 0)
+   {
+      ReadBytes(BinaryWriter::ALIGNMENT - remainder);
+   }
+}
+
+bool BinaryReader::good() const
+{
+   return good_;
+}
+
+const char* BinaryReader::ReadBytes(std::size_t size)
+{
+   const char* data = nullptr;
+
+   if (good_ && size <= data_.size() - position_)
+   {
+      data = data_.data() + position_;
+      position_ += size;
+   }
+   else
+   {
+      good_ = false;
+   }
+
+   return data;
+}
+
+} // namespace util
+} // namespace scwx
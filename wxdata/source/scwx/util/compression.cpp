@@ -0,0 +1,237 @@
+#include <scwx/util/compression.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <bzlib.h>
+#include <zlib.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::compression";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+// Output buffers are initially sized for a typical compression ratio when no
+// capacity has been reserved
+static constexpr std::size_t kInitialRatio_ = 8u;
+static constexpr std::size_t kMinimumSize_  = 4096u;
+
+// bzip2 and zlib count available bytes as unsigned int
+static constexpr std::size_t kMaxChunkSize_ =
+   std::numeric_limits<unsigned int>::max();
+
+static void GrowOutput(std::vector<char>& output,
+                       std::size_t        offset,
+                       std::size_t        inputSize)
+{
+   std::size_t size = std::max(output.capacity(), offset);
+
+   if (size == offset)
+   {
+      size = std::max(offset * 2u,
+                      offset + std::max(inputSize * kInitialRatio_,
+                                        kMinimumSize_));
+   }
+
+   output.resize(size);
+}
+
+// Decompresses a bzip2 stream, or its first maxOutputSize bytes
+static bool Bunzip2(std::span<const char> input,
+                    std::vector<char>&    output,
+                    std::size_t           maxOutputSize =
+                       std::numeric_limits<std::size_t>::max())
+{
+   bz_stream stream {};
+   int       status = BZ2_bzDecompressInit(&stream, 0, 0);
+
+   if (status != BZ_OK)
+   {
+      logger_->warn("Could not initialize bzip2 decompressor: {}", status);
+      return false;
+   }
+
+   std::size_t inputOffset  = 0;
+   std::size_t outputOffset = output.size();
+   std::size_t outputEnd    = std::numeric_limits<std::size_t>::max();
+   bool        outputFull   = false;
+
+   if (maxOutputSize < outputEnd - outputOffset)
+   {
+      outputEnd = outputOffset + maxOutputSize;
+   }
+
+   while (status == BZ_OK)
+   {
+      if (outputOffset == output.size())
+      {
+         GrowOutput(output, outputOffset, input.size());
+         output.resize(std::min(output.size(), outputEnd));
+      }
+
+      const std::size_t inputChunk =
+         std::min(input.size() - inputOffset, kMaxChunkSize_);
+      const std::size_t outputChunk =
+         std::min(output.size() - outputOffset, kMaxChunkSize_);
+
+      // bzip2 does not modify the input buffer
+      stream.next_in   = const_cast<char*>(input.data() + inputOffset);
+      stream.avail_in  = static_cast<unsigned int>(inputChunk);
+      stream.next_out  = output.data() + outputOffset;
+      stream.avail_out = static_cast<unsigned int>(outputChunk);
+
+      status = BZ2_bzDecompress(&stream);
+
+      inputOffset += inputChunk - stream.avail_in;
+      outputOffset += outputChunk - stream.avail_out;
+
+      if (status == BZ_OK && outputOffset == outputEnd)
+      {
+         // The requested output size has been decompressed
+         outputFull = true;
+         break;
+      }
+      else if (status == BZ_OK && inputOffset == input.size() &&
+               stream.avail_out != 0)
+      {
+         // The input ended before the end of the stream
+         status = BZ_UNEXPECTED_EOF;
+      }
+   }
+
+   BZ2_bzDecompressEnd(&stream);
+   output.resize(outputOffset);
+
+   if (status != BZ_STREAM_END && !outputFull)
+   {
+      logger_->warn("Error decompressing bzip2 data: {}", status);
+   }
+
+   return status == BZ_STREAM_END || outputFull;
+}
+
+bool DecompressBzip2(std::span<const char> input, std::vector<char>& output)
+{
+   return Bunzip2(input, output);
+}
+
+bool DecompressBzip2Prefix(std::span<const char> input,
+                           std::vector<char>&    output,
+                           std::size_t           size)
+{
+   return Bunzip2(input, output, size);
+}
+
+// Decompresses a zlib (windowBits 15) or gzip (windowBits 31) stream, or
+// its first maxOutputSize bytes
+static bool Inflate(std::span<const char> input,
+                    std::vector<char>&    output,
+                    std::size_t&          bytesConsumed,
+                    int                   windowBits,
+                    std::size_t           maxOutputSize =
+                       std::numeric_limits<std::size_t>::max())
+{
+   z_stream stream {};
+   int      status = inflateInit2(&stream, windowBits);
+
+   bytesConsumed = 0;
+
+   if (status != Z_OK)
+   {
+      logger_->warn("Could not initialize zlib decompressor: {}", status);
+      return false;
+   }
+
+   std::size_t outputOffset = output.size();
+   std::size_t outputEnd    = std::numeric_limits<std::size_t>::max();
+   bool        outputFull   = false;
+
+   if (maxOutputSize < outputEnd - outputOffset)
+   {
+      outputEnd = outputOffset + maxOutputSize;
+   }
+
+   while (status == Z_OK)
+   {
+      if (outputOffset == output.size())
+      {
+         GrowOutput(output, outputOffset, input.size());
+         output.resize(std::min(output.size(), outputEnd));
+      }
+
+      const std::size_t inputChunk =
+         std::min(input.size() - bytesConsumed, kMaxChunkSize_);
+      const std::size_t outputChunk =
+         std::min(output.size() - outputOffset, kMaxChunkSize_);
+
+      // zlib does not modify the input buffer
+      stream.next_in = reinterpret_cast<Bytef*>(
+         const_cast<char*>(input.data() + bytesConsumed));
+      stream.avail_in  = static_cast<uInt>(inputChunk);
+      stream.next_out  = reinterpret_cast<Bytef*>(output.data() + outputOffset);
+      stream.avail_out = static_cast<uInt>(outputChunk);
+
+      status = inflate(&stream, Z_NO_FLUSH);
+
+      bytesConsumed += inputChunk - stream.avail_in;
+      outputOffset += outputChunk - stream.avail_out;
+
+      if ((status == Z_OK || status == Z_BUF_ERROR) &&
+          outputOffset == outputEnd)
+      {
+         // The requested output size has been decompressed
+         outputFull = true;
+         break;
+      }
+      else if (status == Z_OK && bytesConsumed == input.size() &&
+               stream.avail_out != 0)
+      {
+         // The input ended before the end of the stream
+         status = Z_DATA_ERROR;
+      }
+      else if (status == Z_BUF_ERROR && stream.avail_out == 0)
+      {
+         // No progress was possible without more output space
+         status = Z_OK;
+      }
+   }
+
+   inflateEnd(&stream);
+   output.resize(outputOffset);
+
+   if (status != Z_STREAM_END && !outputFull)
+   {
+      logger_->warn("Error decompressing zlib data: {}", status);
+   }
+
+   return status == Z_STREAM_END || outputFull;
+}
+
+bool DecompressZlib(std::span<const char> input,
+                    std::vector<char>&    output,
+                    std::size_t&          bytesConsumed)
+{
+   return Inflate(input, output, bytesConsumed, MAX_WBITS);
+}
+
+bool DecompressZlibPrefix(std::span<const char> input,
+                          std::vector<char>&    output,
+                          std::size_t           size)
+{
+   std::size_t bytesConsumed = 0;
+   return Inflate(input, output, bytesConsumed, MAX_WBITS, size);
+}
+
+bool DecompressGzip(std::span<const char> input,
+                    std::vector<char>&    output,
+                    std::size_t&          bytesConsumed)
+{
+   return Inflate(input, output, bytesConsumed, MAX_WBITS + 16);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,135 @@
+#include <scwx/util/run_length.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+   (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define SCWX_RUN_LENGTH_SSE2
+#   include <emmintrin.h>
+#endif
+
+namespace scwx
+{
+namespace util
+{
+
+// The maximum run is 15, so a single 16 byte store covers any run
+static constexpr std::size_t kMaxRun_ = 15u;
+
+std::size_t DecodeRunLengthScalar(std::span<const std::uint8_t> data,
+                                  std::span<std::uint8_t>       output)
+{
+   std::size_t b = 0;
+
+   for (auto it = data.begin(); it != data.end() && b < output.size(); ++it)
+   {
+      std::uint8_t run   = *it >> 4;
+      std::uint8_t value = *it & 0x0f;
+
+      for (int i = 0; i < run && b < output.size(); i++)
+      {
+         output[b++] = value;
+      }
+   }
+
+   // Clear the remainder of the output, including any values written past
+   // the final run by a wide store
+   std::fill(output.begin() + static_cast<std::ptrdiff_t>(b), output.end(), 0);
+
+   return b;
+}
+
+std::size_t CountRunLengthScalar(std::span<const std::uint8_t> data)
+{
+   std::size_t count = 0;
+
+   for (std::uint8_t byte : data)
+   {
+      count += byte >> 4;
+   }
+
+   return count;
+}
+
+#if defined(SCWX_RUN_LENGTH_SSE2)
+
+std::size_t DecodeRunLength(std::span<const std::uint8_t> data,
+                            std::span<std::uint8_t>       output)
+{
+   std::size_t i = 0;
+   std::size_t b = 0;
+
+   // Store 16 copies of each value, and advance by the run. The final stores
+   // may extend up to 15 bytes past the run, so they are only made while the
+   // output has room for them. Bytes written past the run are overwritten by
+   // subsequent runs, or cleared by the scalar decoder.
+   for (; i < data.size() && b + kMaxRun_ < output.size(); ++i)
+   {
+      const std::uint8_t byte = data[i];
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output.data() + b),
+                       _mm_set1_epi8(static_cast<char>(byte & 0x0f)));
+      b += byte >> 4;
+   }
+
+   // Decode the remainder without writing past the end of the output, and
+   // clear any trailing values
+   return b + DecodeRunLengthScalar(data.subspan(i), output.subspan(b));
+}
+
+std::size_t CountRunLength(std::span<const std::uint8_t> data)
+{
+   const __m128i mask = _mm_set1_epi8(0x0f);
+   const __m128i zero = _mm_setzero_si128();
+   __m128i       sums = _mm_setzero_si128();
+
+   std::size_t i = 0;
+
+   // Sum the upper nibbles of 16 bytes at a time into two 64-bit sums
+   for (; i + 16u <= data.size(); i += 16u)
+   {
+      const __m128i bytes =
+         _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + i));
+      const __m128i runs = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+
+      sums = _mm_add_epi64(sums, _mm_sad_epu8(runs, zero));
+   }
+
+   std::uint64_t sum[2];
+   _mm_storeu_si128(reinterpret_cast<__m128i*>(sum), sums);
+
+   return static_cast<std::size_t>(sum[0] + sum[1]) +
+          CountRunLengthScalar(data.subspan(i));
+}
+
+#else
+
+std::size_t DecodeRunLength(std::span<const std::uint8_t> data,
+                            std::span<std::uint8_t>       output)
+{
+   std::size_t i = 0;
+   std::size_t b = 0;
+
+   // Without SIMD, each run is written using a fixed size fill, which the
+   // compiler lowers to a single wide store
+   for (; i < data.size() && b + kMaxRun_ < output.size(); ++i)
+   {
+      const std::uint8_t byte = data[i];
+
+      std::memset(output.data() + b, byte & 0x0f, kMaxRun_ + 1u);
+      b += byte >> 4;
+   }
+
+   return b + DecodeRunLengthScalar(data.subspan(i), output.subspan(b));
+}
+
+std::size_t CountRunLength(std::span<const std::uint8_t> data)
+{
+   return CountRunLengthScalar(data);
+}
+
+#endif
+
+} // namespace util
+} // namespace scwx
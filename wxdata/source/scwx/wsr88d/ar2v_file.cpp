@@ -1,11 +1,25 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/rda/deferred_level2_message.hpp>
 #include <scwx/wsr88d/rda/level2_message_factory.hpp>
+#include <scwx/wsr88d/rda/packed_elevation_scan.hpp>
 #include <scwx/wsr88d/rda/types.hpp>
+#include <scwx/util/arenabuf.hpp>
+#include <scwx/util/binary.hpp>
+#include <scwx/util/compression.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/rangebuf.hpp>
 #include <scwx/util/time.hpp>
 
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <execution>
+#include <filesystem>
 #include <fstream>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <set>
+#include <shared_mutex>
 #include <sstream>
 
 #if defined(_MSC_VER)
@@ -18,9 +32,9 @@
 #   pragma GCC diagnostic ignored "-Wdeprecated-copy"
 #endif
 
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#include <boost/iostreams/filter/bzip2.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/iostreams/stream.hpp>
 
 #if defined(__GNUC__)
 #   pragma GCC diagnostic pop
@@ -30,6 +44,8 @@
 #   pragma warning(pop)
 #endif
 
+#include <fmt/format.h>
+
 namespace scwx
 {
 namespace wsr88d
@@ -38,6 +54,11 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::ar2v_file";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static constexpr char          kCacheMagic_[8]      = {'S', 'C', 'W', 'X',
+                                                       'A', 'R', '2', 'C'};
+static constexpr std::uint32_t kCacheVersion_       = 1u;
+static constexpr std::uint32_t kCacheByteOrderMark_ = 0x01020304u;
+
 class Ar2vFileImpl
 {
 public:
@@ -47,18 +68,43 @@ public:
        julianDate_ {0},
        milliseconds_ {0},
        icao_ {},
+       endTime_ {},
+       vcpMessage_ {nullptr},
        vcpData_ {nullptr},
        radarData_ {},
        index_ {},
-       rawRecords_ {} {};
+       metadataMessages_ {},
+       ldmRecords_ {},
+       completedElevations_ {},
+       elevationCompleteCallback_ {},
+       dataMutex_ {} {};
    ~Ar2vFileImpl() = default;
 
    std::size_t DecompressLDMRecords(std::istream& is);
    void        HandleMessage(std::shared_ptr<rda::Level2Message>& message);
+   void        IndexElevation(std::uint16_t              elevationIndex,
+                              const rda::ElevationScan& scan);
    void        IndexFile();
-   void        ParseLDMRecords();
-   void        ParseLDMRecord(std::istream& is);
+   void        PublishCompletedElevations();
+   bool        ReadVolumeHeader(std::istream& is);
+   void        SummarizeRecord(const std::vector<char>& compressedData,
+                               bool                     metadataRecord,
+                               Ar2vVolumeSummary&       summary);
+   void        ParseLDMRecords(const Ar2vLoadOptions& options);
+   void        ParseLDMRecord(std::istream& is, const Ar2vLoadOptions& options);
    void        ProcessRadarData(std::shared_ptr<rda::DigitalRadarData> message);
+   bool        ReadCache(util::BinaryReader&         reader,
+                         std::shared_ptr<const void> storage);
+   std::shared_ptr<rda::PackedElevationScan>
+   SelectElevationCut(rda::DataBlockType                    dataBlockType,
+                      float                                 elevation,
+                      std::chrono::system_clock::time_point time,
+                      float&                                elevationCut,
+                      std::vector<float>& elevationCuts) const;
+   void WriteCache(util::BinaryWriter& writer) const;
+
+   static bool ReadCompressedRecord(std::istream&      is,
+                                    std::vector<char>& compressedData);
 
    std::string   tapeFilename_;
    std::string   extensionNumber_;
@@ -66,14 +112,42 @@ public:
    std::uint32_t milliseconds_;
    std::string   icao_;
 
-   std::shared_ptr<rda::VolumeCoveragePatternData>              vcpData_;
+   // Collection time of the latest radial
+   std::chrono::system_clock::time_point endTime_;
+
+   // The undecoded VCP message is retained so it can be written to a cache
+   std::shared_ptr<rda::DeferredLevel2Message>     vcpMessage_;
+   std::shared_ptr<rda::VolumeCoveragePatternData> vcpData_;
+
+   // Radials of elevation cuts which have not yet been indexed. Once a cut is
+   // packed, its radial messages are released.
    std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>> radarData_;
 
-   std::map<rda::DataBlockType,
-            std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>>
+   // Each elevation angle may be scanned more than once per volume (e.g.,
+   // SAILS and MRLE supplemental cuts), so cuts are indexed by start time
+   typedef std::map<std::chrono::system_clock::time_point,
+                    std::shared_ptr<rda::PackedElevationScan>>
+      ElevationCutMap;
+
+   std::map<rda::DataBlockType, std::map<std::uint16_t, ElevationCutMap>>
       index_;
 
-   std::list<std::stringstream> rawRecords_;
+   // Metadata messages are not decoded until they are requested
+   std::map<rda::MessageId, std::shared_ptr<rda::Level2Message>>
+      metadataMessages_;
+
+   // Decompressed LDM records, each of which is an arena referenced in place
+   // by the messages parsed from it
+   std::vector<std::shared_ptr<std::vector<char>>> ldmRecords_;
+
+   // Elevations whose final radial has been received during an incremental
+   // load, but which have not yet been indexed
+   std::vector<std::uint16_t>          completedElevations_;
+   Ar2vFile::ElevationCompleteCallback elevationCompleteCallback_;
+
+   // Protects endTime_, index_ and metadataMessages_ from readers during
+   // incremental loads
+   mutable std::shared_mutex dataMutex_;
 };
 
 Ar2vFile::Ar2vFile() : p(std::make_unique<Ar2vFileImpl>()) {}
@@ -104,24 +178,8 @@ std::chrono::system_clock::time_point Ar2vFile::start_time() const
 
 std::chrono::system_clock::time_point Ar2vFile::end_time() const
 {
-   std::chrono::system_clock::time_point endTime {};
-
-   if (p->radarData_.size() > 0)
-   {
-      std::shared_ptr<rda::DigitalRadarData> lastRadial =
-         p->radarData_.crbegin()->second->crbegin()->second;
-
-      endTime = util::TimePoint(lastRadial->modified_julian_date(),
-                                lastRadial->collection_time());
-   }
-
-   return endTime;
-}
-
-std::map<uint16_t, std::shared_ptr<rda::ElevationScan>>
-Ar2vFile::radar_data() const
-{
-   return p->radarData_;
+   std::shared_lock lock {p->dataMutex_};
+   return p->endTime_;
 }
 
 std::shared_ptr<const rda::VolumeCoveragePatternData> Ar2vFile::vcp_data() const
@@ -129,64 +187,194 @@ std::shared_ptr<const rda::VolumeCoveragePatternData> Ar2vFile::vcp_data() const
    return p->vcpData_;
 }
 
-std::tuple<std::shared_ptr<rda::ElevationScan>, float, std::vector<float>>
-Ar2vFile::GetElevationScan(rda::DataBlockType dataBlockType,
-                           float              elevation,
-                           std::chrono::system_clock::time_point /*time*/) const
+std::tuple<std::shared_ptr<rda::PackedElevationScan>,
+           float,
+           std::vector<float>>
+Ar2vFile::GetPackedElevationScan(
+   rda::DataBlockType                    dataBlockType,
+   float                                 elevation,
+   std::chrono::system_clock::time_point time) const
 {
-   logger_->debug("GetElevationScan: {} degrees", elevation);
+   logger_->debug("GetPackedElevationScan: {} degrees", elevation);
+
+   std::shared_ptr<rda::PackedElevationScan> packedScan   = nullptr;
+   float                                     elevationCut = 0.0f;
+   std::vector<float>                        elevationCuts;
 
+   std::shared_lock lock {p->dataMutex_};
+
+   packedScan = p->SelectElevationCut(
+      dataBlockType, elevation, time, elevationCut, elevationCuts);
+
+   return {packedScan, elevationCut, elevationCuts};
+}
+
+std::shared_ptr<rda::PackedElevationScan> Ar2vFileImpl::SelectElevationCut(
+   rda::DataBlockType                    dataBlockType,
+   float                                 elevation,
+   std::chrono::system_clock::time_point time,
+   float&                                elevationCut,
+   std::vector<float>&                   elevationCuts) const
+{
    constexpr float scaleFactor = 8.0f / 0.043945f;
 
-   std::shared_ptr<rda::ElevationScan> elevationScan = nullptr;
-   float                               elevationCut  = 0.0f;
-   std::vector<float>                  elevationCuts;
+   std::shared_ptr<rda::PackedElevationScan> packedScan = nullptr;
 
    uint16_t codedElevation =
       static_cast<uint16_t>(std::lroundf(elevation * scaleFactor));
 
-   if (p->index_.contains(dataBlockType))
+   auto scansIt = index_.find(dataBlockType);
+
+   if (scansIt != index_.cend() && !scansIt->second.empty())
    {
-      auto scans = p->index_.at(dataBlockType);
+      const auto& scans = scansIt->second;
 
-      uint16_t lowerBound = scans.cbegin()->first;
-      uint16_t upperBound = scans.crbegin()->first;
+      for (auto& scan : scans)
+      {
+         elevationCuts.push_back(scan.first / scaleFactor);
+      }
 
-      for (auto scan : scans)
+      // Select the closest elevation angle
+      auto elevationIt = scans.lower_bound(codedElevation);
+      if (elevationIt == scans.cend())
+      {
+         --elevationIt;
+      }
+      else if (elevationIt != scans.cbegin())
       {
-         if (scan.first > lowerBound && scan.first <= codedElevation)
+         auto lowerIt = std::prev(elevationIt);
+
+         if (codedElevation - lowerIt->first <
+             elevationIt->first - codedElevation)
          {
-            lowerBound = scan.first;
+            elevationIt = lowerIt;
          }
-         if (scan.first < upperBound && scan.first >= codedElevation)
+      }
+
+      // Select the cut closest in time at the selected elevation angle. If a
+      // default-initialized time point is given, select the latest cut.
+      const ElevationCutMap& cuts = elevationIt->second;
+
+      auto cutIt = cuts.lower_bound(time);
+      if (time == std::chrono::system_clock::time_point {} ||
+          cutIt == cuts.cend())
+      {
+         cutIt = std::prev(cuts.cend());
+      }
+      else if (cutIt != cuts.cbegin())
+      {
+         auto earlierIt = std::prev(cutIt);
+
+         if (time - earlierIt->first <= cutIt->first - time)
          {
-            upperBound = scan.first;
+            cutIt = earlierIt;
          }
-
-         elevationCuts.push_back(scan.first / scaleFactor);
       }
 
-      int32_t lowerDelta = std::abs(static_cast<int32_t>(codedElevation) -
-                                    static_cast<int32_t>(lowerBound));
-      int32_t upperDelta = std::abs(static_cast<int32_t>(codedElevation) -
-                                    static_cast<int32_t>(upperBound));
+      packedScan   = cutIt->second;
+      elevationCut = elevationIt->first / scaleFactor;
+   }
+
+   return packedScan;
+}
+
+std::shared_ptr<rda::Level2Message>
+Ar2vFile::GetMetadataMessage(rda::MessageId messageId) const
+{
+   std::shared_ptr<rda::Level2Message> message = nullptr;
+
+   {
+      std::shared_lock lock {p->dataMutex_};
 
-      if (lowerDelta < upperDelta)
+      auto it = p->metadataMessages_.find(messageId);
+      if (it != p->metadataMessages_.cend())
       {
-         elevationScan = scans.at(lowerBound);
-         elevationCut  = lowerBound / scaleFactor;
+         message = it->second;
       }
-      else
+   }
+
+   if (message != nullptr)
+   {
+      std::shared_ptr<rda::Level2Message> decodedMessage =
+         rda::Level2MessageFactory::Decode(message);
+
+      if (decodedMessage != message)
       {
-         elevationScan = scans.at(upperBound);
-         elevationCut  = upperBound / scaleFactor;
+         // Replace the deferred message with the decoded message
+         std::unique_lock lock {p->dataMutex_};
+
+         auto it = p->metadataMessages_.find(messageId);
+         if (it != p->metadataMessages_.end() && it->second == message)
+         {
+            it->second = decodedMessage;
+         }
       }
+
+      message = decodedMessage;
    }
 
-   return std::tie(elevationScan, elevationCut, elevationCuts);
+   return message;
+}
+
+std::optional<Ar2vVolumeSummary> Ar2vFile::ReadSummary(std::istream& is)
+{
+   logger_->debug("Reading Summary");
+
+   Ar2vFileImpl impl {};
+
+   if (!impl.ReadVolumeHeader(is))
+   {
+      return std::nullopt;
+   }
+
+   Ar2vVolumeSummary summary {};
+   summary.icao_      = impl.icao_;
+   summary.startTime_ = util::TimePoint(impl.julianDate_, impl.milliseconds_);
+
+   std::vector<char> compressedData {};
+   bool              metadataRecord = true;
+
+   while (Ar2vFileImpl::ReadCompressedRecord(is, compressedData))
+   {
+      impl.SummarizeRecord(compressedData, metadataRecord, summary);
+      metadataRecord = false;
+   }
+
+   if (impl.vcpData_ != nullptr)
+   {
+      summary.volumeCoveragePattern_ = impl.vcpData_->pattern_number();
+   }
+
+   return summary;
+}
+
+std::optional<Ar2vVolumeSummary>
+Ar2vFile::ReadSummaryFile(const std::string& filename)
+{
+   logger_->debug("ReadSummaryFile: {}", filename);
+
+   std::optional<Ar2vVolumeSummary> summary {};
+
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   if (!f.good())
+   {
+      logger_->warn("Could not open file for reading: {}", filename);
+   }
+   else
+   {
+      summary = ReadSummary(f);
+   }
+
+   return summary;
 }
 
 bool Ar2vFile::LoadFile(const std::string& filename)
+{
+   return LoadFile(filename, {});
+}
+
+bool Ar2vFile::LoadFile(const std::string&     filename,
+                        const Ar2vLoadOptions& options)
 {
    logger_->debug("LoadFile: {}", filename);
    bool fileValid = true;
@@ -200,31 +388,190 @@ bool Ar2vFile::LoadFile(const std::string& filename)
 
    if (fileValid)
    {
-      fileValid = LoadData(f);
+      fileValid = LoadData(f, options);
    }
 
    return fileValid;
 }
 
 bool Ar2vFile::LoadData(std::istream& is)
+{
+   return LoadData(is, {});
+}
+
+bool Ar2vFile::LoadData(std::istream& is, const Ar2vLoadOptions& options)
 {
    logger_->debug("Loading Data");
 
+   bool dataValid = p->ReadVolumeHeader(is);
+
+   if (dataValid)
+   {
+      size_t decompressedRecords = p->DecompressLDMRecords(is);
+      if (decompressedRecords == 0)
+      {
+         p->ParseLDMRecord(is, options);
+      }
+      else
+      {
+         p->ParseLDMRecords(options);
+      }
+   }
+
+   p->completedElevations_.clear();
+   p->IndexFile();
+
+   return dataValid;
+}
+
+bool Ar2vFile::LoadLDMRecords(std::istream& is, const Ar2vLoadOptions& options)
+{
+   logger_->debug("Loading LDM Records");
+
+   bool dataValid = true;
+
+   // The first chunk of a volume begins with the Volume Header Record
+   std::streampos startPosition = is.tellg();
+   std::string    tapeFilename(4, ' ');
+   is.read(tapeFilename.data(), 4);
+   is.seekg(startPosition, std::ios_base::beg);
+
+   if (tapeFilename.starts_with("AR2V"))
+   {
+      dataValid = p->ReadVolumeHeader(is);
+   }
+   else if (p->tapeFilename_.empty())
+   {
+      logger_->warn("LDM records received before Volume Header Record");
+      dataValid = false;
+   }
+
+   if (dataValid && p->DecompressLDMRecords(is) > 0)
+   {
+      p->ParseLDMRecords(options);
+      p->PublishCompletedElevations();
+   }
+
+   return dataValid;
+}
+
+bool Ar2vFile::LoadChunkFile(const std::string&     filename,
+                             const Ar2vLoadOptions& options)
+{
+   logger_->debug("LoadChunkFile: {}", filename);
+   bool fileValid = true;
+
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   if (!f.good())
+   {
+      logger_->warn("Could not open file for reading: {}", filename);
+      fileValid = false;
+   }
+
+   if (fileValid)
+   {
+      fileValid = LoadLDMRecords(f, options);
+   }
+
+   return fileValid;
+}
+
+bool Ar2vFile::WriteCache(const std::string& filename) const
+{
+   logger_->debug("WriteCache: {}", filename);
+
+   if (p->vcpMessage_ == nullptr)
+   {
+      logger_->warn("Cannot write cache without VCP data");
+      return false;
+   }
+
+   // Write to a uniquely named temporary file, so a partially written cache
+   // is never read, and concurrent writers of the same cache do not collide
+   static std::atomic<std::uint32_t> tempCounter {0u};
+   const std::string                 tempFilename =
+      fmt::format("{}.{:08x}{:08x}.tmp",
+                  filename,
+                  std::random_device {}(),
+                  tempCounter.fetch_add(1u));
+
+   std::ofstream f(tempFilename,
+                   std::ios_base::out | std::ios_base::binary |
+                      std::ios_base::trunc);
+   if (!f.good())
+   {
+      logger_->warn("Could not open file for writing: {}", tempFilename);
+      return false;
+   }
+
+   util::BinaryWriter writer {f};
+   p->WriteCache(writer);
+   f.close();
+
+   std::error_code ec {};
+   if (!writer.good() || f.fail())
+   {
+      logger_->warn("Error writing cache: {}", tempFilename);
+      std::filesystem::remove(tempFilename, ec);
+      return false;
+   }
+
+   std::filesystem::rename(tempFilename, filename, ec);
+   if (ec)
+   {
+      logger_->warn("Could not rename cache: {}", ec.message());
+      std::filesystem::remove(tempFilename, ec);
+      return false;
+   }
+
+   return true;
+}
+
+bool Ar2vFile::LoadCache(const std::string& filename)
+{
+   logger_->debug("LoadCache: {}", filename);
+
+   // The mapped file is shared by each packed scan referencing it
+   auto file = std::make_shared<boost::iostreams::mapped_file_source>();
+
+   try
+   {
+      file->open(filename);
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->warn("Could not map file: {}: {}", filename, ex.what());
+      return false;
+   }
+
+   util::BinaryReader reader {
+      std::span<const char> {file->data(), file->size()}};
+
+   return p->ReadCache(reader, file);
+}
+
+void Ar2vFile::SetElevationCompleteCallback(ElevationCompleteCallback callback)
+{
+   p->elevationCompleteCallback_ = std::move(callback);
+}
+
+bool Ar2vFileImpl::ReadVolumeHeader(std::istream& is)
+{
    bool dataValid = true;
 
    // Read Volume Header Record
-   p->tapeFilename_.resize(9, ' ');
-   p->extensionNumber_.resize(3, ' ');
-   p->icao_.resize(4, ' ');
+   tapeFilename_.resize(9, ' ');
+   extensionNumber_.resize(3, ' ');
+   icao_.resize(4, ' ');
 
-   is.read(&p->tapeFilename_[0], 9);
-   is.read(&p->extensionNumber_[0], 3);
-   is.read(reinterpret_cast<char*>(&p->julianDate_), 4);
-   is.read(reinterpret_cast<char*>(&p->milliseconds_), 4);
-   is.read(&p->icao_[0], 4);
+   is.read(&tapeFilename_[0], 9);
+   is.read(&extensionNumber_[0], 3);
+   is.read(reinterpret_cast<char*>(&julianDate_), 4);
+   is.read(reinterpret_cast<char*>(&milliseconds_), 4);
+   is.read(&icao_[0], 4);
 
-   p->julianDate_   = ntohl(p->julianDate_);
-   p->milliseconds_ = ntohl(p->milliseconds_);
+   julianDate_   = ntohl(julianDate_);
+   milliseconds_ = ntohl(milliseconds_);
 
    if (is.eof())
    {
@@ -234,104 +581,440 @@ bool Ar2vFile::LoadData(std::istream& is)
 
    if (dataValid)
    {
-      logger_->debug("Filename:  {}", p->tapeFilename_);
-      logger_->debug("Extension: {}", p->extensionNumber_);
-      logger_->debug("Date:      {}", p->julianDate_);
-      logger_->debug("Time:      {}", p->milliseconds_);
-      logger_->debug("ICAO:      {}", p->icao_);
+      logger_->debug("Filename:  {}", tapeFilename_);
+      logger_->debug("Extension: {}", extensionNumber_);
+      logger_->debug("Date:      {}", julianDate_);
+      logger_->debug("Time:      {}", milliseconds_);
+      logger_->debug("ICAO:      {}", icao_);
+   }
 
-      size_t decompressedRecords = p->DecompressLDMRecords(is);
-      if (decompressedRecords == 0)
+   return dataValid;
+}
+
+void Ar2vFileImpl::WriteCache(util::BinaryWriter& writer) const
+{
+   struct CachedCut
+   {
+      std::uint16_t                         elevationAngle_ {0};
+      std::chrono::system_clock::time_point scanTime_ {};
+      std::uint16_t                         momentMask_ {0};
+   };
+
+   auto writeString = [&writer](const std::string& str)
+   {
+      writer.Write<std::uint32_t>(static_cast<std::uint32_t>(str.size()));
+      writer.WriteArray(std::span<const char> {str});
+   };
+   auto writeTime = [&writer](std::chrono::system_clock::time_point time)
+   {
+      writer.Write<std::int64_t>(
+         std::chrono::duration_cast<std::chrono::milliseconds>(
+            time.time_since_epoch())
+            .count());
+   };
+
+   std::shared_lock lock {dataMutex_};
+
+   // Each packed scan is shared by all moments indexed at its cut
+   std::map<std::shared_ptr<rda::PackedElevationScan>, CachedCut> cuts {};
+   for (auto& [dataBlockType, elevationCuts] : index_)
+   {
+      for (auto& [elevationAngle, cutMap] : elevationCuts)
       {
-         p->ParseLDMRecord(is);
+         for (auto& [scanTime, packedScan] : cutMap)
+         {
+            CachedCut& cachedCut      = cuts[packedScan];
+            cachedCut.elevationAngle_ = elevationAngle;
+            cachedCut.scanTime_       = scanTime;
+            cachedCut.momentMask_ |= static_cast<std::uint16_t>(
+               1u << static_cast<unsigned>(dataBlockType));
+         }
       }
-      else
+   }
+
+   writer.Write(kCacheMagic_);
+   writer.Write(kCacheVersion_);
+   writer.Write(kCacheByteOrderMark_);
+   writeString(tapeFilename_);
+   writeString(extensionNumber_);
+   writeString(icao_);
+   writer.Write(julianDate_);
+   writer.Write(milliseconds_);
+
+   writeTime(endTime_);
+
+   // The VCP message is written as received, with its big endian header, so
+   // it can be decoded by the message factory
+   const rda::Level2MessageHeader& header = vcpMessage_->header();
+   std::array<char, rda::Level2MessageHeader::SIZE> headerData {};
+   const std::uint16_t messageSize       = htons(header.message_size());
+   const std::uint8_t  channel           = header.rda_redundant_channel();
+   const std::uint8_t  messageType       = header.message_type();
+   const std::uint16_t idSequenceNumber  = htons(header.id_sequence_number());
+   const std::uint16_t julianDate        = htons(header.julian_date());
+   const std::uint32_t millisecondsOfDay = htonl(header.milliseconds_of_day());
+   const std::uint16_t numberOfSegments =
+      htons(header.number_of_message_segments());
+   const std::uint16_t segmentNumber = htons(header.message_segment_number());
+   std::memcpy(&headerData[0], &messageSize, 2);
+   std::memcpy(&headerData[2], &channel, 1);
+   std::memcpy(&headerData[3], &messageType, 1);
+   std::memcpy(&headerData[4], &idSequenceNumber, 2);
+   std::memcpy(&headerData[6], &julianDate, 2);
+   std::memcpy(&headerData[8], &millisecondsOfDay, 4);
+   std::memcpy(&headerData[12], &numberOfSegments, 2);
+   std::memcpy(&headerData[14], &segmentNumber, 2);
+
+   std::span<const char> vcpData = vcpMessage_->data();
+   writer.Write<std::uint64_t>(headerData.size() + vcpData.size());
+   writer.WriteArray(std::span<const char> {headerData});
+   writer.WriteArray(vcpData);
+
+   writer.Write<std::uint64_t>(cuts.size());
+   for (auto& [packedScan, cachedCut] : cuts)
+   {
+      writer.Write(cachedCut.elevationAngle_);
+      writer.Write(cachedCut.momentMask_);
+      writeTime(cachedCut.scanTime_);
+      packedScan->Write(writer);
+   }
+}
+
+bool Ar2vFileImpl::ReadCache(util::BinaryReader&         reader,
+                             std::shared_ptr<const void> storage)
+{
+   auto readString = [&reader](std::string& str)
+   {
+      std::uint32_t         size = 0;
+      std::span<const char> data {};
+      reader.Read(size);
+      reader.ReadArray(size, data);
+      str.assign(data.begin(), data.end());
+   };
+   auto readTime = [&reader](std::chrono::system_clock::time_point& time)
+   {
+      std::int64_t milliseconds = 0;
+      reader.Read(milliseconds);
+      time = std::chrono::system_clock::time_point {
+         std::chrono::milliseconds {milliseconds}};
+   };
+
+   std::array<char, sizeof(kCacheMagic_)> magic {};
+   std::uint32_t                          version       = 0;
+   std::uint32_t                          byteOrderMark = 0;
+
+   reader.Read(magic);
+   reader.Read(version);
+   reader.Read(byteOrderMark);
+
+   if (!reader.good() ||
+       !std::equal(magic.cbegin(), magic.cend(), std::begin(kCacheMagic_)) ||
+       version != kCacheVersion_ || byteOrderMark != kCacheByteOrderMark_)
+   {
+      logger_->warn("Invalid cache header");
+      return false;
+   }
+
+   readString(tapeFilename_);
+   readString(extensionNumber_);
+   readString(icao_);
+   reader.Read(julianDate_);
+   reader.Read(milliseconds_);
+   readTime(endTime_);
+
+   std::uint64_t         vcpSize = 0;
+   std::span<const char> vcpData {};
+   reader.Read(vcpSize);
+   reader.ReadArray(vcpSize, vcpData);
+
+   if (!reader.good())
+   {
+      logger_->warn("Could not read cache");
+      return false;
+   }
+
+   boost::iostreams::stream<boost::iostreams::array_source> vcpStream {
+      vcpData.data(), vcpData.size()};
+   rda::Level2MessageInfo msgInfo = rda::Level2MessageFactory::Create(
+      vcpStream,
+      rda::Level2MessageFactory::CreateContext(
+         {rda::MessageId::DigitalRadarData}));
+   if (!msgInfo.messageValid)
+   {
+      logger_->warn("Could not read cached VCP data");
+      return false;
+   }
+   HandleMessage(msgInfo.message);
+
+   std::uint64_t cutCount = 0;
+   reader.Read(cutCount);
+
+   for (std::uint64_t i = 0; i < cutCount && reader.good(); ++i)
+   {
+      std::uint16_t                         elevationAngle = 0;
+      std::uint16_t                         momentMask     = 0;
+      std::chrono::system_clock::time_point scanTime {};
+
+      reader.Read(elevationAngle);
+      reader.Read(momentMask);
+      readTime(scanTime);
+
+      auto packedScan = rda::PackedElevationScan::Read(reader, storage);
+      if (packedScan == nullptr)
+      {
+         break;
+      }
+
+      std::unique_lock lock {dataMutex_};
+
+      for (rda::DataBlockType dataBlockType :
+           rda::MomentDataBlockTypeIterator())
       {
-         p->ParseLDMRecords();
+         if (momentMask & (1u << static_cast<unsigned>(dataBlockType)))
+         {
+            index_[dataBlockType][elevationAngle][scanTime] = packedScan;
+         }
       }
    }
 
-   p->IndexFile();
+   if (!reader.good() || vcpData_ == nullptr)
+   {
+      logger_->warn("Could not read cache");
+      return false;
+   }
 
-   return dataValid;
+   return true;
+}
+
+bool Ar2vFileImpl::ReadCompressedRecord(std::istream&      is,
+                                        std::vector<char>& compressedData)
+{
+   if (is.peek() == EOF)
+   {
+      return false;
+   }
+
+   // Each record is prefixed by a control word containing its compressed size
+   std::streampos startPosition = is.tellg();
+   int32_t        controlWord   = 0;
+   size_t         recordSize;
+
+   is.read(reinterpret_cast<char*>(&controlWord), 4);
+
+   controlWord = ntohl(controlWord);
+   recordSize  = std::abs(controlWord);
+
+   logger_->trace("LDM Record Found: Size = {} bytes", recordSize);
+
+   if (recordSize == 0)
+   {
+      is.seekg(startPosition, std::ios_base::beg);
+      return false;
+   }
+
+   compressedData.resize(recordSize);
+   is.read(compressedData.data(), recordSize);
+   compressedData.resize(static_cast<std::size_t>(is.gcount()));
+
+   return true;
 }
 
 size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
 {
    logger_->debug("Decompressing LDM Records");
 
-   size_t numRecords = 0;
+   struct LDMRecord
+   {
+      std::vector<char>                  compressedData_ {};
+      std::shared_ptr<std::vector<char>> arena_ {};
+      bool                               valid_ {false};
+   };
+
+   std::vector<LDMRecord> records {};
+   std::vector<char>      compressedData {};
 
-   while (is.peek() != EOF)
+   // Read all records sequentially before decompressing them concurrently
+   while (ReadCompressedRecord(is, compressedData))
    {
-      std::streampos startPosition = is.tellg();
-      int32_t        controlWord   = 0;
-      size_t         recordSize;
+      records.emplace_back().compressedData_ = std::move(compressedData);
+      compressedData                         = {};
+   }
 
-      is.read(reinterpret_cast<char*>(&controlWord), 4);
+   std::for_each(
+      std::execution::par,
+      records.begin(),
+      records.end(),
+      [&](LDMRecord& record)
+      {
+         // Decompress directly from the compressed record into the arena from
+         // which the record is parsed, without an intermediate copy
+         record.arena_ = std::make_shared<std::vector<char>>();
+         record.valid_ =
+            util::DecompressBzip2(record.compressedData_, *record.arena_);
 
-      controlWord = ntohl(controlWord);
-      recordSize  = std::abs(controlWord);
+         if (record.valid_)
+         {
+            logger_->trace("Decompressed record size = {} bytes",
+                           record.arena_->size());
+         }
+         else
+         {
+            logger_->warn("Error decompressing record {}",
+                          &record - records.data());
+         }
 
-      logger_->trace("LDM Record Found: Size = {} bytes", recordSize);
+         // Release the compressed data as soon as it is no longer needed
+         record.compressedData_ = {};
+      });
 
-      if (recordSize == 0)
+   // Preserve record order for parsing
+   for (LDMRecord& record : records)
+   {
+      if (record.valid_)
       {
-         is.seekg(startPosition, std::ios_base::beg);
-         break;
+         ldmRecords_.push_back(std::move(record.arena_));
       }
+   }
 
-      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-      util::rangebuf r(is.rdbuf(), recordSize);
-      in.push(boost::iostreams::bzip2_decompressor());
-      in.push(r);
+   size_t numRecords = records.size();
 
-      try
-      {
-         std::stringstream ss;
-         std::streamsize   bytesCopied = boost::iostreams::copy(in, ss);
-         logger_->trace("Decompressed record size = {} bytes", bytesCopied);
+   logger_->debug("Decompressed {} LDM Records", numRecords);
 
-         rawRecords_.push_back(std::move(ss));
-      }
-      catch (const boost::iostreams::bzip2_error& ex)
+   return numRecords;
+}
+
+void Ar2vFileImpl::SummarizeRecord(const std::vector<char>& compressedData,
+                                   bool                     metadataRecord,
+                                   Ar2vVolumeSummary&       summary)
+{
+   if (metadataRecord)
+   {
+      // Decode the metadata record in full to obtain the VCP
+      auto arena = std::make_shared<std::vector<char>>();
+      if (util::DecompressBzip2(compressedData, *arena))
       {
-         logger_->warn(
-            "Error decompressing record {}: {}", numRecords, ex.what());
+         util::arenabuf recordBuffer {arena, 0, arena->size()};
+         std::istream   recordStream {&recordBuffer};
 
-         is.seekg(startPosition + std::streampos(recordSize),
-                  std::ios_base::beg);
+         ParseLDMRecord(recordStream, {});
       }
+      return;
+   }
+
+   // Only decompress and decode the first radial of other records, even if the
+   // metadata record did not contain a VCP. Each elevation cut begins a new
+   // record. The message size is limited to the maximum size of a single
+   // message.
+   static constexpr std::size_t kCtmHeaderSize_ = 12u;
+   static constexpr std::size_t kMaxMessageSize_ =
+      std::numeric_limits<std::uint16_t>::max() * 2u;
 
-      ++numRecords;
+   std::vector<char> recordData {};
+   util::DecompressBzip2Prefix(
+      compressedData, recordData, kCtmHeaderSize_ + kMaxMessageSize_);
+
+   if (recordData.size() < kCtmHeaderSize_ + rda::Level2MessageHeader::SIZE)
+   {
+      return;
    }
 
-   logger_->debug("Decompressed {} LDM Records", numRecords);
+   boost::iostreams::stream<boost::iostreams::array_source> is {
+      recordData.data(), recordData.size()};
+   is.seekg(kCtmHeaderSize_, std::ios_base::beg);
 
-   return numRecords;
+   rda::Level2MessageHeader header {};
+   if (!header.Parse(is) ||
+       header.message_type() !=
+          static_cast<std::uint8_t>(rda::MessageId::DigitalRadarData))
+   {
+      return;
+   }
+
+   // The message size includes the header, and must fit within the record
+   const std::size_t messageSize =
+      static_cast<std::size_t>(header.message_size()) * 2u;
+   const std::size_t remainingSize =
+      recordData.size() - kCtmHeaderSize_ - rda::Level2MessageHeader::SIZE;
+
+   if (messageSize < rda::Level2MessageHeader::SIZE ||
+       messageSize - rda::Level2MessageHeader::SIZE > remainingSize)
+   {
+      logger_->warn("Invalid message size: {}", messageSize);
+      return;
+   }
+
+   boost::iostreams::stream<boost::iostreams::array_source> messageStream {
+      recordData.data() + kCtmHeaderSize_ + rda::Level2MessageHeader::SIZE,
+      messageSize - rda::Level2MessageHeader::SIZE};
+
+   auto radial =
+      rda::DigitalRadarData::Create(std::move(header), messageStream);
+   if (radial == nullptr)
+   {
+      return;
+   }
+
+   const std::uint16_t elevationIndex = radial->elevation_number() - 1;
+
+   if (!summary.elevationCuts_.empty() &&
+       summary.elevationCuts_.back().elevationIndex_ == elevationIndex)
+   {
+      // Continuation of the current elevation cut
+      return;
+   }
+
+   Ar2vElevationCutSummary& cut = summary.elevationCuts_.emplace_back();
+
+   cut.elevationIndex_ = elevationIndex;
+   cut.elevationAngle_ =
+      (vcpData_ != nullptr &&
+       elevationIndex < vcpData_->number_of_elevation_cuts()) ?
+         static_cast<float>(vcpData_->elevation_angle(elevationIndex)) :
+         radial->elevation_angle();
+   cut.startTime_ = util::TimePoint(radial->modified_julian_date(),
+                                    radial->collection_time());
+
+   for (rda::DataBlockType dataBlockType : rda::MomentDataBlockTypeIterator())
+   {
+      if (radial->moment_data_block(dataBlockType) != nullptr)
+      {
+         cut.moments_.push_back(dataBlockType);
+      }
+   }
 }
 
-void Ar2vFileImpl::ParseLDMRecords()
+void Ar2vFileImpl::ParseLDMRecords(const Ar2vLoadOptions& options)
 {
    logger_->debug("Parsing LDM Records");
 
    size_t count = 0;
 
-   for (auto it = rawRecords_.begin(); it != rawRecords_.end(); it++)
+   for (auto& record : ldmRecords_)
    {
-      std::stringstream& ss = *it;
+      util::arenabuf recordBuffer {record, 0, record->size()};
+      std::istream   is {&recordBuffer};
 
       logger_->trace("Record {}", count++);
 
-      ParseLDMRecord(ss);
+      ParseLDMRecord(is, options);
    }
 
-   rawRecords_.clear();
+   // Parsed messages hold their own references to their record's arena
+   ldmRecords_.clear();
 }
 
-void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
+void Ar2vFileImpl::ParseLDMRecord(std::istream&          is,
+                                  const Ar2vLoadOptions& options)
 {
-   auto ctx = rda::Level2MessageFactory::CreateContext();
+   // By default, only messages required for display are decoded during the
+   // load. The VCP is retained undecoded so it can be written to a cache, and
+   // is decoded as soon as it is received. Radar data is always decoded, as
+   // radials are indexed into elevation scans as they are received.
+   std::set<rda::MessageId> eagerMessageTypes = options.eagerMessageTypes_;
+   eagerMessageTypes.erase(rda::MessageId::VolumeCoveragePatternData);
+   eagerMessageTypes.insert(rda::MessageId::DigitalRadarData);
+
+   auto ctx = rda::Level2MessageFactory::CreateContext(eagerMessageTypes);
 
    // The communications manager inserts an extra 12 bytes at the beginning
    // of each record
@@ -383,8 +1066,10 @@ void Ar2vFileImpl::HandleMessage(std::shared_ptr<rda::Level2Message>& message)
    switch (message->header().message_type())
    {
    case static_cast<uint8_t>(rda::MessageId::VolumeCoveragePatternData):
-      vcpData_ =
-         std::static_pointer_cast<rda::VolumeCoveragePatternData>(message);
+      vcpMessage_ =
+         std::dynamic_pointer_cast<rda::DeferredLevel2Message>(message);
+      vcpData_ = std::static_pointer_cast<rda::VolumeCoveragePatternData>(
+         rda::Level2MessageFactory::Decode(message));
       break;
 
    case static_cast<uint8_t>(rda::MessageId::DigitalRadarData):
@@ -392,6 +1077,18 @@ void Ar2vFileImpl::HandleMessage(std::shared_ptr<rda::Level2Message>& message)
          std::static_pointer_cast<rda::DigitalRadarData>(message));
       break;
 
+   case static_cast<uint8_t>(rda::MessageId::RdaStatusData):
+   case static_cast<uint8_t>(rda::MessageId::PerformanceMaintenanceData):
+   case static_cast<uint8_t>(rda::MessageId::ClutterFilterBypassMap):
+   case static_cast<uint8_t>(rda::MessageId::ClutterFilterMap):
+   case static_cast<uint8_t>(rda::MessageId::RdaAdaptationData):
+   {
+      std::unique_lock lock {dataMutex_};
+      metadataMessages_[static_cast<rda::MessageId>(
+         message->header().message_type())] = message;
+      break;
+   }
+
    default:
       break;
    }
@@ -403,12 +1100,32 @@ void Ar2vFileImpl::ProcessRadarData(
    uint16_t azimuthIndex   = message->azimuth_number() - 1;
    uint16_t elevationIndex = message->elevation_number() - 1;
 
-   if (radarData_[elevationIndex] == nullptr)
+   auto it = radarData_.find(elevationIndex);
+   if (it == radarData_.end())
    {
-      radarData_[elevationIndex] = std::make_shared<rda::ElevationScan>();
+      it = radarData_
+              .emplace(elevationIndex, std::make_shared<rda::ElevationScan>())
+              .first;
    }
 
-   (*radarData_[elevationIndex])[azimuthIndex] = message;
+   (*it->second)[azimuthIndex] = message;
+
+   {
+      // The end time may be read while later chunks are loading
+      std::unique_lock lock {dataMutex_};
+      endTime_ = std::max(endTime_,
+                          util::TimePoint(message->modified_julian_date(),
+                                          message->collection_time()));
+   }
+
+   const rda::RadialStatus radialStatus =
+      static_cast<rda::RadialStatus>(message->radial_status());
+
+   if (radialStatus == rda::RadialStatus::EndOfElevation ||
+       radialStatus == rda::RadialStatus::EndOfVolume)
+   {
+      completedElevations_.push_back(elevationIndex);
+   }
 }
 
 void Ar2vFileImpl::IndexFile()
@@ -421,41 +1138,90 @@ void Ar2vFileImpl::IndexFile()
       return;
    }
 
-   for (auto elevationCut : radarData_)
+   std::for_each(std::execution::par,
+                 radarData_.begin(),
+                 radarData_.end(),
+                 [this](auto& elevationCut)
+                 { IndexElevation(elevationCut.first, *elevationCut.second); });
+
+   // Packed scans hold their own references to the gates of each moment
+   radarData_.clear();
+}
+
+void Ar2vFileImpl::PublishCompletedElevations()
+{
+   if (vcpData_ == nullptr)
    {
-      uint16_t elevationAngle =
-         vcpData_->elevation_angle_raw(elevationCut.first);
-      rda::WaveformType waveformType =
-         vcpData_->waveform_type(elevationCut.first);
+      if (!completedElevations_.empty())
+      {
+         logger_->warn("Cannot index elevations without VCP data");
+      }
+      return;
+   }
 
-      std::shared_ptr<rda::DigitalRadarData> radial0 =
-         (*elevationCut.second)[0];
+   for (std::uint16_t elevationIndex : completedElevations_)
+   {
+      logger_->debug("Elevation {} complete", elevationIndex);
 
-      if (radial0 == nullptr)
+      auto it = radarData_.find(elevationIndex);
+      if (it == radarData_.end())
       {
-         logger_->warn("Empty radial data");
          continue;
       }
 
-      for (rda::DataBlockType dataBlockType :
-           rda::MomentDataBlockTypeIterator())
+      IndexElevation(elevationIndex, *it->second);
+      radarData_.erase(it);
+
+      if (elevationCompleteCallback_)
       {
-         if (dataBlockType == rda::DataBlockType::MomentRef &&
-             waveformType ==
-                rda::WaveformType::ContiguousDopplerWithAmbiguityResolution)
-         {
-            // Reflectivity data is contained within both surveillance and
-            // doppler modes.  Surveillance mode produces a better image.
-            continue;
-         }
+         elevationCompleteCallback_(
+            elevationIndex,
+            static_cast<float>(vcpData_->elevation_angle(elevationIndex)));
+      }
+   }
 
-         auto momentData = radial0->moment_data_block(dataBlockType);
+   completedElevations_.clear();
+}
 
-         if (momentData != nullptr)
-         {
-            // TODO: Handle multiple elevation scans
-            index_[dataBlockType][elevationAngle] = elevationCut.second;
-         }
+void Ar2vFileImpl::IndexElevation(std::uint16_t             elevationIndex,
+                                  const rda::ElevationScan& scan)
+{
+   uint16_t elevationAngle = vcpData_->elevation_angle_raw(elevationIndex);
+   rda::WaveformType waveformType = vcpData_->waveform_type(elevationIndex);
+
+   auto radial0It = scan.find(0);
+
+   if (radial0It == scan.end() || radial0It->second == nullptr)
+   {
+      logger_->warn("Empty radial data");
+      return;
+   }
+
+   std::shared_ptr<rda::DigitalRadarData> radial0 = radial0It->second;
+   std::chrono::system_clock::time_point  scanTime = util::TimePoint(
+      radial0->modified_julian_date(), radial0->collection_time());
+
+   // Moment data is copied into the packed scan, releasing the radials
+   auto packedScan = rda::PackedElevationScan::Create(scan);
+
+   std::unique_lock lock {dataMutex_};
+
+   for (rda::DataBlockType dataBlockType : rda::MomentDataBlockTypeIterator())
+   {
+      if (dataBlockType == rda::DataBlockType::MomentRef &&
+          waveformType ==
+             rda::WaveformType::ContiguousDopplerWithAmbiguityResolution)
+      {
+         // Reflectivity data is contained within both surveillance and doppler
+         // modes.  Surveillance mode produces a better image.
+         continue;
+      }
+
+      auto momentData = radial0->moment_data_block(dataBlockType);
+
+      if (momentData != nullptr)
+      {
+         index_[dataBlockType][elevationAngle][scanTime] = packedScan;
       }
    }
 }
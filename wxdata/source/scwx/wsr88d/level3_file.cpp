@@ -1,33 +1,17 @@
 #include <scwx/wsr88d/level3_file.hpp>
 #include <scwx/wsr88d/rpg/ccb_header.hpp>
 #include <scwx/wsr88d/rpg/level3_message_factory.hpp>
+#include <scwx/util/arenabuf.hpp>
+#include <scwx/util/compression.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <execution>
+#include <filesystem>
 #include <fstream>
-#include <sstream>
-
-#if defined(_MSC_VER)
-#   pragma warning(push)
-#   pragma warning(disable : 4702)
-#   pragma warning(disable : 4706)
-#endif
-
-#if defined(__GNUC__)
-#   pragma GCC diagnostic push
-#   pragma GCC diagnostic ignored "-Wdeprecated-copy"
-#endif
-
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#include <boost/iostreams/filter/zlib.hpp>
-
-#if defined(__GNUC__)
-#   pragma GCC diagnostic pop
-#endif
-
-#if defined(_MSC_VER)
-#   pragma warning(pop)
-#endif
+#include <span>
+#include <vector>
 
 namespace scwx
 {
@@ -37,6 +21,14 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::level3_file";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+// A summary reads at most this much compressed data, and decompresses at most
+// this much of it, which contains the headers and product description block
+static constexpr std::size_t kSummaryCompressedSize_   = 4096u;
+static constexpr std::size_t kSummaryDecompressedSize_ = 1024u;
+
+static bool ReadProductDescription(std::istream&         is,
+                                   Level3ProductSummary& summary);
+
 class Level3FileImpl
 {
 public:
@@ -44,7 +36,8 @@ public:
        wmoHeader_ {}, ccbHeader_ {}, innerHeader_ {}, message_ {} {};
    ~Level3FileImpl() = default;
 
-   bool DecompressFile(std::istream& is, std::stringstream& ss);
+   bool DecompressFile(std::istream& is, std::vector<char>& data);
+   bool LoadCompressedHeaders(std::istream& is);
    bool LoadFileData(std::istream& is);
 
    std::shared_ptr<awips::WmoHeader>   wmoHeader_;
@@ -69,6 +62,141 @@ std::shared_ptr<rpg::Level3Message> Level3File::message() const
    return p->message_;
 }
 
+std::optional<Level3ProductSummary> Level3File::ReadSummary(std::istream& is)
+{
+   logger_->debug("Reading Summary");
+
+   Level3ProductSummary summary {};
+
+   // Determine the size of the product, if the stream is seekable
+   const std::streampos dataStart = is.tellg();
+   is.seekg(0, std::ios_base::end);
+   const std::streamoff dataSize = is.tellg() - dataStart;
+   is.seekg(dataStart, std::ios_base::beg);
+
+   if (dataStart >= 0 && dataSize >= 0)
+   {
+      summary.size_ = static_cast<std::size_t>(dataSize);
+   }
+   else
+   {
+      is.clear();
+   }
+
+   awips::WmoHeader wmoHeader {};
+   bool             dataValid = wmoHeader.Parse(is);
+
+   if (dataValid)
+   {
+      summary.productCategory_   = wmoHeader.product_category();
+      summary.productDesignator_ = wmoHeader.product_designator();
+
+      // If the header is compressed
+      if (is.peek() == 0x78)
+      {
+         std::vector<char>     compressedData {};
+         std::span<const char> input =
+            util::ReadInPlace(is, compressedData, kSummaryCompressedSize_);
+
+         // Only decompress the headers and product description block
+         auto data = std::make_shared<std::vector<char>>();
+         util::DecompressZlibPrefix(input, *data, kSummaryDecompressedSize_);
+
+         util::arenabuf dataBuffer {data, 0, data->size()};
+         std::istream   dataStream {&dataBuffer};
+         Level3FileImpl impl {};
+
+         dataValid = impl.LoadCompressedHeaders(dataStream) &&
+                     ReadProductDescription(dataStream, summary);
+      }
+      else
+      {
+         dataValid = ReadProductDescription(is, summary);
+      }
+   }
+
+   if (!dataValid)
+   {
+      return std::nullopt;
+   }
+
+   return summary;
+}
+
+std::optional<Level3ProductSummary>
+Level3File::ReadSummaryFile(const std::string& filename)
+{
+   logger_->debug("ReadSummaryFile: {}", filename);
+
+   std::optional<Level3ProductSummary> summary {};
+
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   if (!f.good())
+   {
+      logger_->warn("Could not open file for reading: {}", filename);
+   }
+   else
+   {
+      summary = ReadSummary(f);
+   }
+
+   return summary;
+}
+
+std::vector<std::optional<Level3ProductSummary>>
+Level3File::ReadSummaryFiles(const std::vector<std::string>& filenames)
+{
+   std::vector<std::optional<Level3ProductSummary>> summaries(
+      filenames.size());
+
+   std::transform(std::execution::par,
+                  filenames.cbegin(),
+                  filenames.cend(),
+                  summaries.begin(),
+                  [](const std::string& filename)
+                  { return ReadSummaryFile(filename); });
+
+   return summaries;
+}
+
+std::map<std::string, Level3ProductSummary>
+Level3File::ReadSummaryDirectory(const std::string& directory)
+{
+   logger_->debug("ReadSummaryDirectory: {}", directory);
+
+   std::vector<std::string> filenames {};
+   std::error_code          ec {};
+
+   for (const auto& entry :
+        std::filesystem::directory_iterator {directory, ec})
+   {
+      if (entry.is_regular_file(ec))
+      {
+         filenames.push_back(entry.path().string());
+      }
+   }
+
+   if (ec)
+   {
+      logger_->warn("Could not list directory: {}", ec.message());
+   }
+
+   std::vector<std::optional<Level3ProductSummary>> summaries =
+      ReadSummaryFiles(filenames);
+
+   std::map<std::string, Level3ProductSummary> summaryMap {};
+
+   for (std::size_t i = 0; i < filenames.size(); ++i)
+   {
+      if (summaries[i].has_value())
+      {
+         summaryMap.emplace(filenames[i], std::move(*summaries[i]));
+      }
+   }
+
+   return summaryMap;
+}
+
 bool Level3File::LoadFile(const std::string& filename)
 {
    logger_->debug("LoadFile: {}", filename);
@@ -108,13 +236,18 @@ bool Level3File::LoadData(std::istream& is)
       // If the header is compressed
       if (is.peek() == 0x78)
       {
-         std::stringstream ss;
+         auto data = std::make_shared<std::vector<char>>();
 
-         dataValid = p->DecompressFile(is, ss);
+         dataValid = p->DecompressFile(is, *data);
 
          if (dataValid)
          {
-            dataValid = p->LoadFileData(ss);
+            // Parse the decompressed data in place
+            util::arenabuf dataBuffer {data, 0, data->size()};
+            std::istream   dataStream {&dataBuffer};
+
+            dataValid = p->LoadCompressedHeaders(dataStream) &&
+                        p->LoadFileData(dataStream);
          }
       }
       else
@@ -126,57 +259,60 @@ bool Level3File::LoadData(std::istream& is)
    return dataValid;
 }
 
-bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
+bool Level3FileImpl::DecompressFile(std::istream& is, std::vector<char>& data)
 {
    bool dataValid = true;
 
-   std::streampos  dataStart          = is.tellg();
-   std::streamsize totalBytesCopied   = 0;
-   int             totalBytesConsumed = 0;
-
-   while (dataValid && is.peek() == 0x78)
-      try
-      {
-         boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-         boost::iostreams::zlib_decompressor zlibDecompressor;
-         in.push(zlibDecompressor);
-         in.push(is);
-
-         std::streamsize bytesCopied   = boost::iostreams::copy(in, ss);
-         int             bytesConsumed = zlibDecompressor.filter().total_in();
+   // Read the remainder of the stream, which may contain multiple
+   // consecutive zlib streams. Data already in memory is not copied.
+   std::streampos        dataStart = is.tellg();
+   std::vector<char>     compressedData {};
+   std::span<const char> input = util::ReadInPlace(is, compressedData);
+   std::size_t           totalBytesConsumed = 0;
 
-         totalBytesCopied += bytesCopied;
-         totalBytesConsumed += bytesConsumed;
+   while (dataValid && totalBytesConsumed < input.size() &&
+          input[totalBytesConsumed] == 0x78)
+   {
+      std::size_t bytesConsumed = 0;
 
-         is.seekg(dataStart + static_cast<std::streamoff>(totalBytesConsumed),
-                  std::ios_base::beg);
+      dataValid = util::DecompressZlib(
+         input.subspan(totalBytesConsumed), data, bytesConsumed);
+      totalBytesConsumed += bytesConsumed;
 
-         if (bytesConsumed <= 0)
-         {
-            // Not sure this will ever occur, but will prevent an infinite loop
-            break;
-         }
-      }
-      catch (const boost::iostreams::zlib_error& ex)
+      if (bytesConsumed == 0)
       {
-         logger_->warn("Error decompressing data: {}", ex.what());
-
-         dataValid = false;
+         // Not sure this will ever occur, but will prevent an infinite loop
+         break;
       }
+   }
 
    if (dataValid)
    {
-      logger_->trace("Input data consumed = {} bytes", totalBytesCopied);
-      logger_->trace("Decompressed data size = {} bytes", totalBytesConsumed);
-
-      ccbHeader_ = std::make_shared<rpg::CcbHeader>();
-      dataValid  = ccbHeader_->Parse(ss);
+      logger_->trace("Input data consumed = {} bytes", totalBytesConsumed);
+      logger_->trace("Decompressed data size = {} bytes", data.size());
+   }
+   else
+   {
+      logger_->warn("Error decompressing data");
    }
 
+   // Leave the input stream positioned after the compressed data
+   is.clear();
+   is.seekg(dataStart + static_cast<std::streamoff>(totalBytesConsumed),
+            std::ios_base::beg);
+
+   return dataValid;
+}
+
+bool Level3FileImpl::LoadCompressedHeaders(std::istream& is)
+{
+   ccbHeader_     = std::make_shared<rpg::CcbHeader>();
+   bool dataValid = ccbHeader_->Parse(is);
+
    if (dataValid)
    {
       innerHeader_ = std::make_shared<awips::WmoHeader>();
-      dataValid    = innerHeader_->Parse(ss);
+      dataValid    = innerHeader_->Parse(is);
    }
 
    return dataValid;
@@ -189,5 +325,44 @@ bool Level3FileImpl::LoadFileData(std::istream& is)
    return (message_ != nullptr);
 }
 
+static bool ReadProductDescription(std::istream&         is,
+                                   Level3ProductSummary& summary)
+{
+   rpg::Level3MessageHeader header {};
+
+   if (!header.Parse(is))
+   {
+      return false;
+   }
+
+   uint32_t julianDate   = header.date_of_message();
+   uint32_t milliseconds = header.time_of_message() * 1000u;
+
+   summary.productCode_ = header.message_code();
+
+   // Product messages contain a product description block following the
+   // message header. General status messages do not.
+   if (header.message_code() >= 16)
+   {
+      rpg::ProductDescriptionBlock descriptionBlock {};
+
+      if (!descriptionBlock.Parse(is))
+      {
+         return false;
+      }
+
+      summary.elevationNumber_ = descriptionBlock.elevation_number();
+      summary.volumeCoveragePattern_ =
+         descriptionBlock.volume_coverage_pattern();
+
+      julianDate   = descriptionBlock.volume_scan_date();
+      milliseconds = descriptionBlock.volume_scan_start_time() * 1000u;
+   }
+
+   summary.time_ = util::TimePoint(julianDate, milliseconds);
+
+   return true;
+}
+
 } // namespace wsr88d
 } // namespace scwx
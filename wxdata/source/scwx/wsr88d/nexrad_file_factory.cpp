@@ -1,33 +1,16 @@
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 #include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/util/arenabuf.hpp>
+#include <scwx/util/compression.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/threads.hpp>
 
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
-#include <sstream>
 
-#if defined(_MSC_VER)
-#   pragma warning(push)
-#   pragma warning(disable : 4702)
-#   pragma warning(disable : 4706)
-#endif
-
-#if defined(__GNUC__)
-#   pragma GCC diagnostic push
-#   pragma GCC diagnostic ignored "-Wdeprecated-copy"
-#endif
-
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#include <boost/iostreams/filter/gzip.hpp>
-
-#if defined(__GNUC__)
-#   pragma GCC diagnostic pop
-#endif
-
-#if defined(_MSC_VER)
-#   pragma warning(pop)
-#endif
+#include <fmt/format.h>
 
 namespace scwx
 {
@@ -37,6 +20,10 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::nexrad_file_factory";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static bool DecompressGzip(std::istream& is, std::vector<char>& data);
+static void PruneCache(const std::string& cacheDirectory,
+                       std::uintmax_t     cacheSizeLimit);
+
 std::shared_ptr<NexradFile>
 NexradFileFactory::Create(const std::string& filename)
 {
@@ -60,15 +47,81 @@ NexradFileFactory::Create(const std::string& filename)
    return nexradFile;
 }
 
+std::shared_ptr<NexradFile>
+NexradFileFactory::Create(const std::string& filename,
+                          const std::string& cacheDirectory,
+                          std::uintmax_t     cacheSizeLimit)
+{
+   logger_->debug("Create: {} (cache: {})", filename, cacheDirectory);
+
+   std::error_code ec {};
+   std::error_code sourceTimeEc {};
+   std::error_code cacheTimeEc {};
+
+   // The cache filename includes a hash of the source path, so files of the
+   // same name in different directories do not collide
+   const std::filesystem::path sourcePath =
+      std::filesystem::absolute(filename, ec);
+   const std::filesystem::path cachePath =
+      std::filesystem::path {cacheDirectory} /
+      fmt::format("{}.{:016x}.ar2c",
+                  sourcePath.filename().string(),
+                  std::hash<std::string> {}(sourcePath.string()));
+
+   const auto sourceTime =
+      std::filesystem::last_write_time(sourcePath, sourceTimeEc);
+   const auto cacheTime =
+      std::filesystem::last_write_time(cachePath, cacheTimeEc);
+
+   // The cache cannot be validated if the source modification time is unknown
+   if (!ec && !sourceTimeEc && !cacheTimeEc && cacheTime >= sourceTime)
+   {
+      std::shared_ptr<Ar2vFile> ar2vFile = std::make_shared<Ar2vFile>();
+      if (ar2vFile->LoadCache(cachePath.string()))
+      {
+         // Mark the cache as recently used. Its modification time remains
+         // newer than the source.
+         std::error_code touchEc {};
+         std::filesystem::last_write_time(
+            cachePath, std::filesystem::file_time_type::clock::now(), touchEc);
+
+         return ar2vFile;
+      }
+   }
+
+   std::shared_ptr<NexradFile> nexradFile = Create(filename);
+
+   std::shared_ptr<Ar2vFile> ar2vFile =
+      std::dynamic_pointer_cast<Ar2vFile>(nexradFile);
+   if (ar2vFile != nullptr && !ec && !sourceTimeEc)
+   {
+      // Write the cache in the background, the file is ready to be displayed
+      util::async(
+         [=]()
+         {
+            std::error_code directoryEc {};
+            std::filesystem::create_directories(cacheDirectory, directoryEc);
+            if (ar2vFile->WriteCache(cachePath.string()))
+            {
+               PruneCache(cacheDirectory, cacheSizeLimit);
+            }
+         });
+   }
+
+   return nexradFile;
+}
+
 std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
 {
    std::shared_ptr<NexradFile> message = nullptr;
 
-   std::istream*     pis      = &is;
-   std::streampos    pisBegin = is.tellg();
-   std::stringstream ss;
-   std::string       buffer;
-   bool              dataValid;
+   std::istream*                      pis      = &is;
+   std::streampos                     pisBegin = is.tellg();
+   std::shared_ptr<std::vector<char>> data {};
+   std::unique_ptr<util::arenabuf>    dataBuffer {};
+   std::istream                       dataStream {nullptr};
+   std::string                        buffer;
+   bool                               dataValid;
 
    buffer.resize(4);
 
@@ -78,34 +131,29 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
 
    if (dataValid && buffer.starts_with("\x1f\x8b"))
    {
-      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-      in.push(boost::iostreams::gzip_decompressor());
-      in.push(is);
+      data      = std::make_shared<std::vector<char>>();
+      dataValid = DecompressGzip(is, *data);
 
-      try
+      if (dataValid)
       {
-         std::streamsize bytesCopied = boost::iostreams::copy(in, ss);
+         // Parse the decompressed data in place
+         dataBuffer = std::make_unique<util::arenabuf>(data, 0, data->size());
+         dataStream.rdbuf(dataBuffer.get());
 
-         pis      = &ss;
-         pisBegin = ss.tellg();
+         pis      = &dataStream;
+         pisBegin = dataStream.tellg();
 
-         ss.read(buffer.data(), 4);
-         dataValid = ss.good();
-         ss.seekg(pisBegin, std::ios_base::beg);
+         dataStream.read(buffer.data(), 4);
+         dataValid = dataStream.good();
+         dataStream.seekg(pisBegin, std::ios_base::beg);
 
-         logger_->trace("Decompressed file = {} bytes", bytesCopied);
+         logger_->trace("Decompressed file = {} bytes", data->size());
 
          if (!dataValid)
          {
             logger_->warn("Error reading decompressed stream");
          }
       }
-      catch (const boost::iostreams::gzip_error& ex)
-      {
-         logger_->warn("Error decompressing file: {}", ex.what());
-
-         dataValid = false;
-      }
    }
    else if (!dataValid)
    {
@@ -137,5 +185,113 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
    return message;
 }
 
+static bool DecompressGzip(std::istream& is, std::vector<char>& data)
+{
+   bool dataValid = true;
+
+   // Data already in memory is decompressed without copying
+   std::vector<char>     compressedData {};
+   std::span<const char> input = util::ReadInPlace(is, compressedData);
+   std::size_t           totalBytesConsumed = 0;
+
+   // The gzip trailer contains the size of the final member's uncompressed
+   // data (modulo 2^32), which is the entire file in the common case. Deflate
+   // cannot exceed a ratio of 1032:1, which bounds a corrupt trailer.
+   if (input.size() >= 4)
+   {
+      const auto* trailer =
+         reinterpret_cast<const std::uint8_t*>(input.data() + input.size() - 4);
+      const std::size_t uncompressedSize =
+         static_cast<std::uint32_t>(trailer[0]) |
+         static_cast<std::uint32_t>(trailer[1]) << 8 |
+         static_cast<std::uint32_t>(trailer[2]) << 16 |
+         static_cast<std::uint32_t>(trailer[3]) << 24;
+
+      data.reserve(std::min(uncompressedSize, input.size() * 1032u));
+   }
+
+   // The file may contain multiple consecutive gzip members
+   while (dataValid && totalBytesConsumed + 1 < input.size() &&
+          input[totalBytesConsumed] == '\x1f' &&
+          input[totalBytesConsumed + 1] == '\x8b')
+   {
+      std::size_t bytesConsumed = 0;
+
+      dataValid = util::DecompressGzip(
+         input.subspan(totalBytesConsumed), data, bytesConsumed);
+      totalBytesConsumed += bytesConsumed;
+
+      if (bytesConsumed == 0)
+      {
+         break;
+      }
+   }
+
+   if (!dataValid)
+   {
+      logger_->warn("Error decompressing file");
+   }
+
+   return dataValid;
+}
+
+static void PruneCache(const std::string& cacheDirectory,
+                       std::uintmax_t     cacheSizeLimit)
+{
+   struct CacheFile
+   {
+      std::filesystem::path           path_ {};
+      std::filesystem::file_time_type time_ {};
+      std::uintmax_t                  size_ {0};
+   };
+
+   std::vector<CacheFile> cacheFiles {};
+   std::uintmax_t         totalSize = 0;
+   std::error_code        ec {};
+
+   for (auto& entry : std::filesystem::directory_iterator(cacheDirectory, ec))
+   {
+      std::error_code entryEc {};
+      if (!entry.is_regular_file(entryEc) ||
+          entry.path().extension() != ".ar2c")
+      {
+         continue;
+      }
+
+      CacheFile& cacheFile = cacheFiles.emplace_back();
+      cacheFile.path_      = entry.path();
+      cacheFile.time_      = entry.last_write_time(entryEc);
+      cacheFile.size_      = entry.file_size(entryEc);
+
+      totalSize += cacheFile.size_;
+   }
+
+   if (totalSize <= cacheSizeLimit)
+   {
+      return;
+   }
+
+   // Remove the least recently used caches first
+   std::sort(cacheFiles.begin(),
+             cacheFiles.end(),
+             [](const CacheFile& a, const CacheFile& b)
+             { return a.time_ < b.time_; });
+
+   for (auto& cacheFile : cacheFiles)
+   {
+      if (totalSize <= cacheSizeLimit)
+      {
+         break;
+      }
+
+      logger_->debug("Removing cache: {}", cacheFile.path_.string());
+
+      if (std::filesystem::remove(cacheFile.path_, ec))
+      {
+         totalSize -= cacheFile.size_;
+      }
+   }
+}
+
 } // namespace wsr88d
 } // namespace scwx
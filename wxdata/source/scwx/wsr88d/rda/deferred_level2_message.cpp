@@ -0,0 +1,106 @@
+#include <scwx/wsr88d/rda/deferred_level2_message.hpp>
+#include <scwx/util/arenabuf.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::string logPrefix_ =
+   "scwx::wsr88d::rda::deferred_level2_message";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+class DeferredLevel2MessageImpl
+{
+public:
+   explicit DeferredLevel2MessageImpl() :
+       arena_ {}, offset_ {0}, size_ {0}, buffer_ {} {};
+   ~DeferredLevel2MessageImpl() = default;
+
+   // The message body is referenced in place when it was parsed from an
+   // arena. Otherwise, it is copied into the buffer.
+   std::shared_ptr<const std::vector<char>> arena_;
+   std::size_t                              offset_;
+   std::size_t                              size_;
+   std::vector<char>                        buffer_;
+};
+
+DeferredLevel2Message::DeferredLevel2Message() :
+    Level2Message(), p(std::make_unique<DeferredLevel2MessageImpl>())
+{
+}
+DeferredLevel2Message::~DeferredLevel2Message() = default;
+
+DeferredLevel2Message::DeferredLevel2Message(
+   DeferredLevel2Message&&) noexcept = default;
+DeferredLevel2Message&
+DeferredLevel2Message::operator=(DeferredLevel2Message&&) noexcept = default;
+
+std::span<const char> DeferredLevel2Message::data() const
+{
+   if (p->arena_ != nullptr)
+   {
+      return {p->arena_->data() + p->offset_, p->size_};
+   }
+
+   return p->buffer_;
+}
+
+bool DeferredLevel2Message::Parse(std::istream& is)
+{
+   logger_->trace("Deferring Message Type {}",
+                  static_cast<unsigned>(header().message_type()));
+
+   bool messageValid = true;
+
+   const std::size_t dataSize = data_size();
+   util::arenabuf*   arena    = dynamic_cast<util::arenabuf*>(is.rdbuf());
+
+   if (arena != nullptr && is.good())
+   {
+      p->arena_  = arena->arena();
+      p->offset_ = static_cast<std::size_t>(arena->current() -
+                                            arena->arena()->data());
+   }
+
+   std::span<const char> data = util::ReadInPlace(is, p->buffer_, dataSize);
+   p->size_                   = data.size();
+
+   if (!p->buffer_.empty())
+   {
+      // The data was not referenced in place
+      p->arena_.reset();
+   }
+
+   if (p->size_ != dataSize)
+   {
+      logger_->warn("Could not read message data");
+      messageValid = false;
+   }
+
+   return messageValid;
+}
+
+std::shared_ptr<DeferredLevel2Message>
+DeferredLevel2Message::Create(Level2MessageHeader&& header, std::istream& is)
+{
+   std::shared_ptr<DeferredLevel2Message> message =
+      std::make_shared<DeferredLevel2Message>();
+   message->set_header(std::move(header));
+
+   if (!message->Parse(is))
+   {
+      message.reset();
+   }
+
+   return message;
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -1,4 +1,5 @@
 #include <scwx/wsr88d/rda/digital_radar_data.hpp>
+#include <scwx/util/arenabuf.hpp>
 #include <scwx/util/logger.hpp>
 
 namespace scwx
@@ -74,6 +75,12 @@ public:
 
    std::vector<uint8_t>  momentGates8_;
    std::vector<uint16_t> momentGates16_;
+
+   // Views of the gate data, referencing either the owned vectors above or
+   // the shared arena the message was parsed from
+   std::span<const uint8_t>           dataMoments8_;
+   std::span<const uint16_t>          dataMoments16_;
+   std::shared_ptr<std::vector<char>> arena_;
 };
 
 MomentDataBlock::MomentDataBlock(const std::string& dataBlockType,
@@ -145,10 +152,10 @@ const void* MomentDataBlock::data_moments() const
    switch (p->dataWordSize_)
    {
    case 8:
-      dataMoments = p->momentGates8_.data();
+      dataMoments = p->dataMoments8_.data();
       break;
    case 16:
-      dataMoments = p->momentGates16_.data();
+      dataMoments = p->dataMoments16_.data();
       break;
    default:
       dataMoments = nullptr;
@@ -158,6 +165,21 @@ const void* MomentDataBlock::data_moments() const
    return dataMoments;
 }
 
+std::span<const uint8_t> MomentDataBlock::data_moments8() const
+{
+   return p->dataMoments8_;
+}
+
+std::span<const uint16_t> MomentDataBlock::data_moments16() const
+{
+   return p->dataMoments16_;
+}
+
+std::shared_ptr<const std::vector<char>> MomentDataBlock::arena() const
+{
+   return p->arena_;
+}
+
 std::shared_ptr<MomentDataBlock>
 MomentDataBlock::Create(const std::string& dataBlockType,
                         const std::string& dataName,
@@ -200,18 +222,56 @@ bool MomentDataBlock::Parse(std::istream& is)
 
    if (p->numberOfDataMomentGates_ <= 1840)
    {
+      // If the stream is backed by an arena, reference the gates in place
+      util::arenabuf*       arena = dynamic_cast<util::arenabuf*>(is.rdbuf());
+      const std::streamsize gateBytes =
+         static_cast<std::streamsize>(p->numberOfDataMomentGates_) *
+         (p->dataWordSize_ / 8);
+      const bool inArena = (arena != nullptr && arena->in_avail() >= gateBytes);
+
       if (p->dataWordSize_ == 8)
       {
-         p->momentGates8_.resize(p->numberOfDataMomentGates_);
-         is.read(reinterpret_cast<char*>(p->momentGates8_.data()),
-                 p->numberOfDataMomentGates_);
+         if (inArena)
+         {
+            p->arena_        = arena->arena();
+            p->dataMoments8_ = {reinterpret_cast<uint8_t*>(arena->current()),
+                                p->numberOfDataMomentGates_};
+            is.seekg(gateBytes, std::ios_base::cur);
+         }
+         else
+         {
+            p->momentGates8_.resize(p->numberOfDataMomentGates_);
+            is.read(reinterpret_cast<char*>(p->momentGates8_.data()),
+                    p->numberOfDataMomentGates_);
+            p->dataMoments8_ = p->momentGates8_;
+         }
       }
       else if (p->dataWordSize_ == 16)
       {
-         p->momentGates16_.resize(p->numberOfDataMomentGates_);
-         is.read(reinterpret_cast<char*>(p->momentGates16_.data()),
-                 p->numberOfDataMomentGates_ * 2);
-         awips::Message::SwapVector(p->momentGates16_);
+         if (inArena && reinterpret_cast<std::uintptr_t>(arena->current()) %
+                              alignof(uint16_t) ==
+                           0)
+         {
+            // The arena is owned by the parser, so the gates can be swapped
+            // to host byte order in place
+            uint16_t* gates = reinterpret_cast<uint16_t*>(arena->current());
+            std::transform(gates,
+                           gates + p->numberOfDataMomentGates_,
+                           gates,
+                           [](uint16_t u) { return ntohs(u); });
+
+            p->arena_         = arena->arena();
+            p->dataMoments16_ = {gates, p->numberOfDataMomentGates_};
+            is.seekg(gateBytes, std::ios_base::cur);
+         }
+         else
+         {
+            p->momentGates16_.resize(p->numberOfDataMomentGates_);
+            is.read(reinterpret_cast<char*>(p->momentGates16_.data()),
+                    p->numberOfDataMomentGates_ * 2);
+            awips::Message::SwapVector(p->momentGates16_);
+            p->dataMoments16_ = p->momentGates16_;
+         }
       }
       else
       {
@@ -4,6 +4,7 @@
 #include <scwx/util/vectorbuf.hpp>
 #include <scwx/wsr88d/rda/clutter_filter_bypass_map.hpp>
 #include <scwx/wsr88d/rda/clutter_filter_map.hpp>
+#include <scwx/wsr88d/rda/deferred_level2_message.hpp>
 #include <scwx/wsr88d/rda/digital_radar_data.hpp>
 #include <scwx/wsr88d/rda/performance_maintenance_data.hpp>
 #include <scwx/wsr88d/rda/rda_adaptation_data.hpp>
@@ -13,6 +14,18 @@
 #include <unordered_map>
 #include <vector>
 
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4702)
+#endif
+
+#include <boost/iostreams/stream.hpp>
+#include <boost/iostreams/device/array.hpp>
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
 namespace scwx
 {
 namespace wsr88d
@@ -43,7 +56,9 @@ struct Level2MessageFactory::Context
        messageData_ {},
        bufferedSize_ {},
        messageBuffer_ {messageData_},
-       messageBufferStream_ {&messageBuffer_}
+       messageBufferStream_ {&messageBuffer_},
+       deferMessages_ {false},
+       eagerMessageTypes_ {}
    {
    }
 
@@ -51,6 +66,9 @@ struct Level2MessageFactory::Context
    size_t            bufferedSize_;
    util::vectorbuf   messageBuffer_;
    std::istream      messageBufferStream_;
+
+   bool                   deferMessages_;
+   std::set<std::uint8_t> eagerMessageTypes_;
 };
 
 std::shared_ptr<Level2MessageFactory::Context>
@@ -59,6 +77,21 @@ Level2MessageFactory::CreateContext()
    return std::make_shared<Context>();
 }
 
+std::shared_ptr<Level2MessageFactory::Context>
+Level2MessageFactory::CreateContext(
+   const std::set<MessageId>& eagerMessageTypes)
+{
+   std::shared_ptr<Context> ctx = std::make_shared<Context>();
+
+   ctx->deferMessages_ = true;
+   for (MessageId messageId : eagerMessageTypes)
+   {
+      ctx->eagerMessageTypes_.insert(static_cast<std::uint8_t>(messageId));
+   }
+
+   return ctx;
+}
+
 Level2MessageInfo Level2MessageFactory::Create(std::istream&            is,
                                                std::shared_ptr<Context> ctx)
 {
@@ -137,8 +170,17 @@ Level2MessageInfo Level2MessageFactory::Create(std::istream&            is,
 
       if (messageStream != nullptr)
       {
-         info.message =
-            create_.at(messageType)(std::move(header), *messageStream);
+         if (ctx->deferMessages_ &&
+             !ctx->eagerMessageTypes_.contains(messageType))
+         {
+            info.message = DeferredLevel2Message::Create(std::move(header),
+                                                         *messageStream);
+         }
+         else
+         {
+            info.message =
+               create_.at(messageType)(std::move(header), *messageStream);
+         }
          ctx->messageData_.resize(0);
          ctx->messageData_.shrink_to_fit();
          ctx->messageBufferStream_.clear();
@@ -160,6 +202,35 @@ Level2MessageInfo Level2MessageFactory::Create(std::istream&            is,
    return info;
 }
 
+std::shared_ptr<Level2Message>
+Level2MessageFactory::Decode(std::shared_ptr<Level2Message> message)
+{
+   std::shared_ptr<DeferredLevel2Message> deferredMessage =
+      std::dynamic_pointer_cast<DeferredLevel2Message>(message);
+
+   if (deferredMessage == nullptr)
+   {
+      // Message has already been decoded
+      return message;
+   }
+
+   const std::uint8_t messageType = deferredMessage->header().message_type();
+
+   auto it = create_.find(messageType);
+   if (it == create_.cend())
+   {
+      logger_->warn("Unknown message type: {}",
+                    static_cast<unsigned>(messageType));
+      return nullptr;
+   }
+
+   std::span<const char> data = deferredMessage->data();
+   boost::iostreams::stream<boost::iostreams::array_source> is {data.data(),
+                                                                data.size()};
+
+   return it->second(Level2MessageHeader {deferredMessage->header()}, is);
+}
+
 } // namespace rda
 } // namespace wsr88d
 } // namespace scwx
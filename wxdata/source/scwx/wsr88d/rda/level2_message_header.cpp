@@ -51,6 +51,20 @@ Level2MessageHeader::Level2MessageHeader() :
 }
 Level2MessageHeader::~Level2MessageHeader() = default;
 
+Level2MessageHeader::Level2MessageHeader(const Level2MessageHeader& other) :
+    p(std::make_unique<Level2MessageHeaderImpl>(*other.p))
+{
+}
+Level2MessageHeader&
+Level2MessageHeader::operator=(const Level2MessageHeader& other)
+{
+   if (this != &other)
+   {
+      *p = *other.p;
+   }
+   return *this;
+}
+
 Level2MessageHeader::Level2MessageHeader(Level2MessageHeader&&) noexcept =
    default;
 Level2MessageHeader&
@@ -0,0 +1,508 @@
+#include <scwx/wsr88d/rda/packed_elevation_scan.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/time.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::string logPrefix_ =
+   "scwx::wsr88d::rda::packed_elevation_scan";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+static constexpr std::size_t kNumMoments_ =
+   static_cast<std::size_t>(DataBlockType::MomentCfp) -
+   static_cast<std::size_t>(DataBlockType::MomentRef) + 1u;
+
+struct PackedMomentData
+{
+   bool          valid_ {false};
+   std::uint16_t gateStride_ {0};
+   std::uint8_t  dataWordSize_ {0};
+   float         scale_ {0.0f};
+   float         offset_ {0.0f};
+   std::int16_t  snrThreshold_ {0};
+
+   // Views of the packed arrays, referencing either the storage below or an
+   // external buffer, such as a memory-mapped cache file
+   std::span<const std::uint16_t> numberOfDataMomentGates_ {};
+   std::span<const std::uint16_t> dataMomentRange_ {};
+   std::span<const std::uint16_t> dataMomentRangeSampleInterval_ {};
+   std::span<const std::uint8_t>  dataMoments8_ {};
+   std::span<const std::uint16_t> dataMoments16_ {};
+
+   std::vector<std::uint16_t> numberOfDataMomentGatesStorage_ {};
+   std::vector<std::uint16_t> dataMomentRangeStorage_ {};
+   std::vector<std::uint16_t> dataMomentRangeSampleIntervalStorage_ {};
+   std::vector<std::uint8_t>  dataMoments8Storage_ {};
+   std::vector<std::uint16_t> dataMoments16Storage_ {};
+};
+
+class PackedElevationScanImpl
+{
+public:
+   explicit PackedElevationScanImpl() = default;
+   ~PackedElevationScanImpl()         = default;
+
+   const PackedMomentData* moment(DataBlockType type) const;
+
+   template<class T>
+   void PackGates(const PackedMomentData&         moment,
+                  const std::vector<const void*>& radialGates,
+                  std::vector<T>&                 storage) const;
+
+   std::size_t                           radialCount_ {0};
+   std::span<const float>                azimuthAngles_ {};
+   std::vector<float>                    azimuthAnglesStorage_ {};
+   float                                 latitude_ {0.0f};
+   float                                 longitude_ {0.0f};
+   std::uint16_t                         volumeCoveragePatternNumber_ {0};
+   std::chrono::system_clock::time_point startTime_ {};
+
+   // Moment matrices are copied out of the parsed messages when the scan is
+   // created, so the scan does not retain the decompressed records
+   std::array<PackedMomentData, kNumMoments_> moments_ {};
+
+   // External buffer referenced by a scan read from a cache
+   std::shared_ptr<const void> storage_ {};
+};
+
+PackedElevationScan::PackedElevationScan() :
+    p(std::make_unique<PackedElevationScanImpl>())
+{
+}
+PackedElevationScan::~PackedElevationScan() = default;
+
+PackedElevationScan::PackedElevationScan(PackedElevationScan&&) noexcept =
+   default;
+PackedElevationScan&
+PackedElevationScan::operator=(PackedElevationScan&&) noexcept = default;
+
+const PackedMomentData*
+PackedElevationScanImpl::moment(DataBlockType type) const
+{
+   const PackedMomentData* momentData = nullptr;
+
+   if (type >= DataBlockType::MomentRef && type <= DataBlockType::MomentCfp)
+   {
+      momentData =
+         &moments_[static_cast<std::size_t>(type) -
+                   static_cast<std::size_t>(DataBlockType::MomentRef)];
+      if (!momentData->valid_)
+      {
+         momentData = nullptr;
+      }
+   }
+
+   return momentData;
+}
+
+std::size_t PackedElevationScan::radial_count() const
+{
+   return p->radialCount_;
+}
+
+std::span<const float> PackedElevationScan::azimuth_angles() const
+{
+   return p->azimuthAngles_;
+}
+
+float PackedElevationScan::latitude() const
+{
+   return p->latitude_;
+}
+
+float PackedElevationScan::longitude() const
+{
+   return p->longitude_;
+}
+
+std::uint16_t PackedElevationScan::volume_coverage_pattern_number() const
+{
+   return p->volumeCoveragePatternNumber_;
+}
+
+std::chrono::system_clock::time_point PackedElevationScan::start_time() const
+{
+   return p->startTime_;
+}
+
+bool PackedElevationScan::has_moment(DataBlockType type) const
+{
+   return p->moment(type) != nullptr;
+}
+
+std::uint16_t PackedElevationScan::gate_stride(DataBlockType type) const
+{
+   const PackedMomentData* momentData = p->moment(type);
+   return (momentData != nullptr) ? momentData->gateStride_ : 0u;
+}
+
+std::uint8_t PackedElevationScan::data_word_size(DataBlockType type) const
+{
+   const PackedMomentData* momentData = p->moment(type);
+   return (momentData != nullptr) ? momentData->dataWordSize_ : 0u;
+}
+
+float PackedElevationScan::scale(DataBlockType type) const
+{
+   const PackedMomentData* momentData = p->moment(type);
+   return (momentData != nullptr) ? momentData->scale_ : 0.0f;
+}
+
+float PackedElevationScan::offset(DataBlockType type) const
+{
+   const PackedMomentData* momentData = p->moment(type);
+   return (momentData != nullptr) ? momentData->offset_ : 0.0f;
+}
+
+std::int16_t PackedElevationScan::snr_threshold_raw(DataBlockType type) const
+{
+   const PackedMomentData* momentData = p->moment(type);
+   return (momentData != nullptr) ? momentData->snrThreshold_ : 0;
+}
+
+std::span<const std::uint16_t>
+PackedElevationScan::number_of_data_moment_gates(DataBlockType type) const
+{
+   const PackedMomentData* momentData = p->moment(type);
+   return (momentData != nullptr) ? momentData->numberOfDataMomentGates_ :
+                                    std::span<const std::uint16_t> {};
+}
+
+std::span<const std::uint16_t>
+PackedElevationScan::data_moment_range_raw(DataBlockType type) const
+{
+   const PackedMomentData* momentData = p->moment(type);
+   return (momentData != nullptr) ? momentData->dataMomentRange_ :
+                                    std::span<const std::uint16_t> {};
+}
+
+std::span<const std::uint16_t>
+PackedElevationScan::data_moment_range_sample_interval_raw(
+   DataBlockType type) const
+{
+   const PackedMomentData* momentData = p->moment(type);
+   return (momentData != nullptr) ? momentData->dataMomentRangeSampleInterval_ :
+                                    std::span<const std::uint16_t> {};
+}
+
+std::span<const std::uint8_t>
+PackedElevationScan::data_moments8(DataBlockType type) const
+{
+   const PackedMomentData* momentData = p->moment(type);
+   return (momentData != nullptr) ? momentData->dataMoments8_ :
+                                    std::span<const std::uint8_t> {};
+}
+
+std::span<const std::uint16_t>
+PackedElevationScan::data_moments16(DataBlockType type) const
+{
+   const PackedMomentData* momentData = p->moment(type);
+   return (momentData != nullptr) ? momentData->dataMoments16_ :
+                                    std::span<const std::uint16_t> {};
+}
+
+std::size_t PackedElevationScan::packed_size(DataBlockType type) const
+{
+   const PackedMomentData* momentData = p->moment(type);
+   if (momentData == nullptr)
+   {
+      return 0u;
+   }
+
+   return momentData->dataMoments8_.size_bytes() +
+          momentData->dataMoments16_.size_bytes();
+}
+
+std::shared_ptr<PackedElevationScan>
+PackedElevationScan::Create(const ElevationScan& elevationScan)
+{
+   auto packedScan = std::make_shared<PackedElevationScan>();
+   auto p          = packedScan.get()->p.get();
+
+   if (elevationScan.empty() || elevationScan.cbegin()->second == nullptr)
+   {
+      logger_->warn("Cannot pack empty elevation scan");
+      return packedScan;
+   }
+
+   const std::size_t radialCount = elevationScan.size();
+   const auto&       radial0     = elevationScan.cbegin()->second;
+
+   p->radialCount_ = radialCount;
+   p->startTime_   = util::TimePoint(radial0->modified_julian_date(),
+                                   radial0->collection_time());
+
+   auto volumeData0 = radial0->volume_data_block();
+   if (volumeData0 != nullptr)
+   {
+      p->latitude_  = volumeData0->latitude();
+      p->longitude_ = volumeData0->longitude();
+      p->volumeCoveragePatternNumber_ =
+         volumeData0->volume_coverage_pattern_number();
+   }
+
+   p->azimuthAnglesStorage_.reserve(radialCount);
+   for (auto& radial : elevationScan)
+   {
+      p->azimuthAnglesStorage_.push_back(
+         (radial.second != nullptr) ? radial.second->azimuth_angle() : 0.0f);
+   }
+   p->azimuthAngles_ = p->azimuthAnglesStorage_;
+
+   for (DataBlockType type : MomentDataBlockTypeIterator())
+   {
+      auto momentData0 = radial0->moment_data_block(type);
+      if (momentData0 == nullptr)
+      {
+         continue;
+      }
+
+      PackedMomentData& moment =
+         p->moments_[static_cast<std::size_t>(type) -
+                     static_cast<std::size_t>(DataBlockType::MomentRef)];
+
+      moment.valid_        = true;
+      moment.dataWordSize_ = momentData0->data_word_size();
+      moment.scale_        = momentData0->scale();
+      moment.offset_       = momentData0->offset();
+      moment.snrThreshold_ = momentData0->snr_threshold_raw();
+
+      moment.numberOfDataMomentGatesStorage_.resize(radialCount, 0u);
+      moment.dataMomentRangeStorage_.resize(radialCount, 0u);
+      moment.dataMomentRangeSampleIntervalStorage_.resize(radialCount, 0u);
+
+      // Collect per-radial metadata and gate locations, and determine the
+      // stride
+      std::vector<const void*> radialGates(radialCount, nullptr);
+
+      std::size_t r = 0;
+      for (auto& radial : elevationScan)
+      {
+         auto momentData = (radial.second != nullptr) ?
+                              radial.second->moment_data_block(type) :
+                              nullptr;
+
+         if (momentData != nullptr &&
+             momentData->data_word_size() == moment.dataWordSize_)
+         {
+            moment.numberOfDataMomentGatesStorage_[r] =
+               momentData->number_of_data_moment_gates();
+            moment.dataMomentRangeStorage_[r] =
+               momentData->data_moment_range_raw();
+            moment.dataMomentRangeSampleIntervalStorage_[r] =
+               momentData->data_moment_range_sample_interval_raw();
+            radialGates[r] = momentData->data_moments();
+
+            moment.gateStride_ =
+               std::max(moment.gateStride_,
+                        moment.numberOfDataMomentGatesStorage_[r]);
+         }
+         else if (momentData != nullptr)
+         {
+            logger_->warn("Radial {} has different word size", radial.first);
+         }
+
+         ++r;
+      }
+
+      moment.numberOfDataMomentGates_ = moment.numberOfDataMomentGatesStorage_;
+      moment.dataMomentRange_         = moment.dataMomentRangeStorage_;
+      moment.dataMomentRangeSampleInterval_ =
+         moment.dataMomentRangeSampleIntervalStorage_;
+
+      // Copy the gates, such that radial messages and their arenas are not
+      // retained by the scan
+      if (moment.dataWordSize_ == 8)
+      {
+         p->PackGates(moment, radialGates, moment.dataMoments8Storage_);
+         moment.dataMoments8_ = moment.dataMoments8Storage_;
+      }
+      else
+      {
+         p->PackGates(moment, radialGates, moment.dataMoments16Storage_);
+         moment.dataMoments16_ = moment.dataMoments16Storage_;
+      }
+   }
+
+   return packedScan;
+}
+
+void PackedElevationScan::Write(util::BinaryWriter& writer) const
+{
+   std::uint8_t momentMask = 0u;
+   for (std::size_t i = 0; i < kNumMoments_; ++i)
+   {
+      if (p->moments_[i].valid_)
+      {
+         momentMask |= static_cast<std::uint8_t>(1u << i);
+      }
+   }
+
+   writer.Write<std::uint64_t>(p->radialCount_);
+   writer.Write<std::int64_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+         p->startTime_.time_since_epoch())
+         .count());
+   writer.Write(p->latitude_);
+   writer.Write(p->longitude_);
+   writer.Write(p->volumeCoveragePatternNumber_);
+   writer.Write(momentMask);
+   writer.WriteArray(p->azimuthAngles_);
+
+   for (DataBlockType type : MomentDataBlockTypeIterator())
+   {
+      const PackedMomentData* moment = p->moment(type);
+      if (moment == nullptr)
+      {
+         continue;
+      }
+
+      writer.Write(moment->dataWordSize_);
+      writer.Write(moment->gateStride_);
+      writer.Write(moment->scale_);
+      writer.Write(moment->offset_);
+      writer.Write(moment->snrThreshold_);
+      writer.WriteArray(moment->numberOfDataMomentGates_);
+      writer.WriteArray(moment->dataMomentRange_);
+      writer.WriteArray(moment->dataMomentRangeSampleInterval_);
+
+      if (moment->dataWordSize_ == 8)
+      {
+         writer.WriteArray(moment->dataMoments8_);
+      }
+      else
+      {
+         writer.WriteArray(moment->dataMoments16_);
+      }
+   }
+}
+
+std::shared_ptr<PackedElevationScan>
+PackedElevationScan::Read(util::BinaryReader&         reader,
+                          std::shared_ptr<const void> storage)
+{
+   auto packedScan = std::make_shared<PackedElevationScan>();
+   auto p          = packedScan.get()->p.get();
+
+   std::uint64_t radialCount = 0;
+   std::int64_t  startTime   = 0;
+   std::uint8_t  momentMask  = 0;
+
+   reader.Read(radialCount);
+   reader.Read(startTime);
+   reader.Read(p->latitude_);
+   reader.Read(p->longitude_);
+   reader.Read(p->volumeCoveragePatternNumber_);
+   reader.Read(momentMask);
+   reader.ReadArray(radialCount, p->azimuthAngles_);
+
+   p->radialCount_ = static_cast<std::size_t>(radialCount);
+   p->startTime_   = std::chrono::system_clock::time_point {
+      std::chrono::milliseconds {startTime}};
+
+   for (std::size_t i = 0; i < kNumMoments_ && reader.good(); ++i)
+   {
+      if ((momentMask & (1u << i)) == 0)
+      {
+         continue;
+      }
+
+      PackedMomentData& moment = p->moments_[i];
+
+      reader.Read(moment.dataWordSize_);
+      reader.Read(moment.gateStride_);
+      reader.Read(moment.scale_);
+      reader.Read(moment.offset_);
+      reader.Read(moment.snrThreshold_);
+      reader.ReadArray(radialCount, moment.numberOfDataMomentGates_);
+      reader.ReadArray(radialCount, moment.dataMomentRange_);
+      reader.ReadArray(radialCount, moment.dataMomentRangeSampleInterval_);
+
+      if (!reader.good() ||
+          (moment.dataWordSize_ != 8 && moment.dataWordSize_ != 16))
+      {
+         logger_->warn("Invalid packed moment data word size");
+         return nullptr;
+      }
+
+      // Consumers index up to the gate count of each radial within its row
+      if (std::any_of(moment.numberOfDataMomentGates_.begin(),
+                      moment.numberOfDataMomentGates_.end(),
+                      [&moment](std::uint16_t gates)
+                      { return gates > moment.gateStride_; }))
+      {
+         logger_->warn("Invalid packed moment gate count");
+         return nullptr;
+      }
+
+      // ReadArray fails if the matrix extends past the end of the buffer. The
+      // gate count is checked first so it cannot wrap.
+      const std::size_t wordSize = moment.dataWordSize_ / 8u;
+      if (moment.gateStride_ != 0 &&
+          radialCount > std::numeric_limits<std::size_t>::max() /
+                           moment.gateStride_ / wordSize)
+      {
+         logger_->warn("Invalid packed moment gate stride");
+         return nullptr;
+      }
+
+      const std::size_t gateCount =
+         static_cast<std::size_t>(radialCount) * moment.gateStride_;
+      if (moment.dataWordSize_ == 8)
+      {
+         reader.ReadArray(gateCount, moment.dataMoments8_);
+      }
+      else
+      {
+         reader.ReadArray(gateCount, moment.dataMoments16_);
+      }
+
+      moment.valid_ = true;
+   }
+
+   if (!reader.good())
+   {
+      logger_->warn("Could not read packed elevation scan");
+      return nullptr;
+   }
+
+   p->storage_ = std::move(storage);
+
+   return packedScan;
+}
+
+template<class T>
+void PackedElevationScanImpl::PackGates(
+   const PackedMomentData&         moment,
+   const std::vector<const void*>& radialGates,
+   std::vector<T>&                 storage) const
+{
+   // Copy gates into the moment matrix
+   const std::size_t stride = moment.gateStride_;
+   storage.resize(radialCount_ * stride, 0u);
+
+   for (std::size_t r = 0; r < radialCount_; ++r)
+   {
+      const std::size_t gates = moment.numberOfDataMomentGatesStorage_[r];
+      const void*       data  = radialGates[r];
+
+      if (gates > 0 && data != nullptr)
+      {
+         std::memcpy(storage.data() + r * stride, data, gates * sizeof(T));
+      }
+   }
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -20,14 +20,11 @@ class DigitalRadialDataArrayPacketImpl
 public:
    struct Radial
    {
-      uint16_t             numberOfBytes_;
-      uint16_t             startAngle_;
-      uint16_t             deltaAngle_;
-      std::vector<uint8_t> level_;
+      uint16_t numberOfBytes_;
+      uint16_t startAngle_;
+      uint16_t deltaAngle_;
 
-      Radial() : numberOfBytes_ {0}, startAngle_ {0}, deltaAngle_ {0}, level_ {}
-      {
-      }
+      Radial() : numberOfBytes_ {0}, startAngle_ {0}, deltaAngle_ {0} {}
    };
 
    explicit DigitalRadialDataArrayPacketImpl() :
@@ -38,6 +35,9 @@ public:
        jCenterOfSweep_ {0},
        rangeScaleFactor_ {0},
        radial_ {},
+       startAngle_ {},
+       deltaAngle_ {},
+       level_ {},
        dataSize_ {0}
    {
    }
@@ -54,6 +54,13 @@ public:
    // Repeat for each radial
    std::vector<Radial> radial_;
 
+   // Start and delta angles of each radial in degrees, stored contiguously
+   std::vector<float> startAngle_;
+   std::vector<float> deltaAngle_;
+
+   // Levels of each radial, stored as a radials × bins matrix
+   std::vector<uint8_t> level_;
+
    size_t dataSize_;
 };
 
@@ -110,18 +117,35 @@ size_t DigitalRadialDataArrayPacket::data_size() const
 
 float DigitalRadialDataArrayPacket::start_angle(uint16_t r) const
 {
-   return p->radial_[r].startAngle_ * 0.1f;
+   return p->startAngle_[r];
 }
 
 float DigitalRadialDataArrayPacket::delta_angle(uint16_t r) const
 {
-   return p->radial_[r].deltaAngle_ * 0.1f;
+   return p->deltaAngle_[r];
 }
 
-const std::vector<uint8_t>&
+std::span<const uint8_t>
 DigitalRadialDataArrayPacket::level(uint16_t r) const
 {
-   return p->radial_[r].level_;
+   return std::span<const uint8_t> {p->level_}.subspan(
+      static_cast<std::size_t>(r) * p->numberOfRangeBins_,
+      p->numberOfRangeBins_);
+}
+
+std::span<const float> DigitalRadialDataArrayPacket::start_angles() const
+{
+   return p->startAngle_;
+}
+
+std::span<const float> DigitalRadialDataArrayPacket::delta_angles() const
+{
+   return p->deltaAngle_;
+}
+
+std::span<const uint8_t> DigitalRadialDataArrayPacket::levels() const
+{
+   return p->level_;
 }
 
 bool DigitalRadialDataArrayPacket::Parse(std::istream& is)
@@ -180,6 +204,10 @@ bool DigitalRadialDataArrayPacket::Parse(std::istream& is)
    if (blockValid)
    {
       p->radial_.resize(p->numberOfRadials_);
+      p->startAngle_.resize(p->numberOfRadials_);
+      p->deltaAngle_.resize(p->numberOfRadials_);
+      p->level_.resize(static_cast<std::size_t>(p->numberOfRadials_) *
+                       p->numberOfRangeBins_);
 
       for (uint16_t r = 0; r < p->numberOfRadials_; r++)
       {
@@ -194,6 +222,9 @@ bool DigitalRadialDataArrayPacket::Parse(std::istream& is)
          radial.startAngle_    = ntohs(radial.startAngle_);
          radial.deltaAngle_    = ntohs(radial.deltaAngle_);
 
+         p->startAngle_[r] = radial.startAngle_ * 0.1f;
+         p->deltaAngle_[r] = radial.deltaAngle_ * 0.1f;
+
          if (radial.numberOfBytes_ < 1 || radial.numberOfBytes_ > 1840)
          {
             logger_->warn("Invalid number of bytes: {} (Radial {})",
@@ -213,10 +244,10 @@ bool DigitalRadialDataArrayPacket::Parse(std::istream& is)
             break;
          }
 
-         // Read radial bins
+         // Read radial bins directly into the level matrix
          size_t dataSize = p->numberOfRangeBins_;
-         radial.level_.resize(dataSize);
-         is.read(reinterpret_cast<char*>(radial.level_.data()), dataSize);
+         is.read(reinterpret_cast<char*>(p->level_.data() + r * dataSize),
+                 dataSize);
 
          is.seekg(radial.numberOfBytes_ - dataSize, std::ios_base::cur);
          bytesRead += radial.numberOfBytes_;
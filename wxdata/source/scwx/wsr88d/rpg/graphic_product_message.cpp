@@ -1,32 +1,12 @@
 #include <scwx/wsr88d/rpg/graphic_product_message.hpp>
+#include <scwx/util/arenabuf.hpp>
+#include <scwx/util/compression.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/rangebuf.hpp>
 
+#include <algorithm>
 #include <istream>
-#include <sstream>
 #include <string>
-
-#if defined(_MSC_VER)
-#   pragma warning(push)
-#   pragma warning(disable : 4702)
-#endif
-
-#if defined(__GNUC__)
-#   pragma GCC diagnostic push
-#   pragma GCC diagnostic ignored "-Wdeprecated-copy"
-#endif
-
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#include <boost/iostreams/filter/bzip2.hpp>
-
-#if defined(__GNUC__)
-#   pragma GCC diagnostic pop
-#endif
-
-#if defined(_MSC_VER)
-#   pragma warning(pop)
-#endif
+#include <vector>
 
 namespace scwx
 {
@@ -39,6 +19,9 @@ static const std::string logPrefix_ =
    "scwx::wsr88d::rpg::graphic_product_message";
 static const auto logger_ = util::Logger::Create(logPrefix_);
 
+// Bounds the buffer reserved for a product with a corrupt uncompressed size
+static constexpr std::size_t kMaxReserveRatio_ = 64u;
+
 class GraphicProductMessageImpl
 {
 public:
@@ -113,24 +96,27 @@ bool GraphicProductMessage::Parse(std::istream& is)
          size_t recordSize =
             (messageLength > prefixLength) ? messageLength - prefixLength : 0;
 
-         boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-         util::rangebuf r(is.rdbuf(), recordSize);
-         in.push(boost::iostreams::bzip2_decompressor());
-         in.push(r);
+         // Decompress the record in place if it is already in memory, into
+         // a buffer sized by the product description block
+         std::vector<char>     compressedData {};
+         std::span<const char> input =
+            util::ReadInPlace(is, compressedData, recordSize);
 
-         try
-         {
-            std::stringstream ss;
-            std::streamsize   bytesCopied = boost::iostreams::copy(in, ss);
-            logger_->trace("Decompressed data size = {} bytes", bytesCopied);
+         auto data = std::make_shared<std::vector<char>>();
+         data->reserve(
+            std::min<std::size_t>(p->descriptionBlock_->uncompressed_size(),
+                                  input.size() * kMaxReserveRatio_));
 
-            dataValid = p->LoadBlocks(ss);
-         }
-         catch (const boost::iostreams::bzip2_error& ex)
+         dataValid = util::DecompressBzip2(input, *data);
+
+         if (dataValid)
          {
-            logger_->warn("Error decompressing data: {}", ex.what());
+            logger_->trace("Decompressed data size = {} bytes", data->size());
+
+            util::arenabuf dataBuffer {data, 0, data->size()};
+            std::istream   dataStream {&dataBuffer};
 
-            dataValid = false;
+            dataValid = p->LoadBlocks(dataStream);
          }
       }
       else
@@ -71,6 +71,31 @@ std::optional<uint16_t> LinkedVectorPacket::value_of_vector() const
    return value;
 }
 
+int16_t LinkedVectorPacket::start_i() const
+{
+   return p->startI_;
+}
+
+int16_t LinkedVectorPacket::start_j() const
+{
+   return p->startJ_;
+}
+
+int16_t LinkedVectorPacket::end_i(size_t v) const
+{
+   return p->endI_[v];
+}
+
+int16_t LinkedVectorPacket::end_j(size_t v) const
+{
+   return p->endJ_[v];
+}
+
+size_t LinkedVectorPacket::vector_count() const
+{
+   return p->endI_.size();
+}
+
 size_t LinkedVectorPacket::data_size() const
 {
    return p->lengthOfBlock_ + 4u;
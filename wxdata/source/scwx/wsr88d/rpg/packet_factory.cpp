@@ -1,5 +1,6 @@
 #include <scwx/wsr88d/rpg/packet_factory.hpp>
 
+#include <scwx/util/arenabuf.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/wsr88d/rpg/cell_trend_data_packet.hpp>
 #include <scwx/wsr88d/rpg/cell_trend_volume_scan_times.hpp>
@@ -25,7 +26,8 @@
 #include <scwx/wsr88d/rpg/vector_arrow_data_packet.hpp>
 #include <scwx/wsr88d/rpg/wind_barb_data_packet.hpp>
 
-#include <unordered_map>
+#include <array>
+#include <cstring>
 
 namespace scwx
 {
@@ -37,44 +39,76 @@ namespace rpg
 static const std::string logPrefix_ = "scwx::wsr88d::rpg::packet_factory";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
-typedef std::function<std::shared_ptr<Packet>(std::istream&)>
-   CreateMessageFunction;
-
-static const std::unordered_map<unsigned int, CreateMessageFunction> create_ {
-   {1, TextAndSpecialSymbolPacket::Create},
-   {2, TextAndSpecialSymbolPacket::Create},
-   {3, MesocycloneSymbolPacket::Create},
-   {4, WindBarbDataPacket::Create},
-   {5, VectorArrowDataPacket::Create},
-   {6, LinkedVectorPacket::Create},
-   {7, UnlinkedVectorPacket::Create},
-   {8, TextAndSpecialSymbolPacket::Create},
-   {9, LinkedVectorPacket::Create},
-   {10, UnlinkedVectorPacket::Create},
-   {11, MesocycloneSymbolPacket::Create},
-   {12, PointGraphicSymbolPacket::Create},
-   {13, PointGraphicSymbolPacket::Create},
-   {14, PointGraphicSymbolPacket::Create},
-   {15, StormIdSymbolPacket::Create},
-   {16, DigitalRadialDataArrayPacket::Create},
-   {17, DigitalPrecipitationDataArrayPacket::Create},
-   {18, PrecipitationRateDataArrayPacket::Create},
-   {19, HdaHailSymbolPacket::Create},
-   {20, PointFeatureSymbolPacket::Create},
-   {21, CellTrendDataPacket::Create},
-   {22, CellTrendVolumeScanTimes::Create},
-   {23, ScitForecastDataPacket::Create},
-   {24, ScitForecastDataPacket::Create},
-   {25, StiCircleSymbolPacket::Create},
-   {26, PointGraphicSymbolPacket::Create},
-   {28, GenericDataPacket::Create},
-   {29, GenericDataPacket::Create},
-   {0x0802, SetColorLevelPacket::Create},
-   {0x0E03, LinkedContourVectorPacket::Create},
-   {0x3501, UnlinkedContourVectorPacket::Create},
-   {0xAF1F, RadialDataPacket::Create},
-   {0xBA07, RasterDataPacket::Create},
-   {0xBA0F, RasterDataPacket::Create}};
+typedef std::shared_ptr<Packet> (*CreatePacketFunction)(std::istream&);
+
+template<class T>
+static std::shared_ptr<Packet> CreatePacket(std::istream& is)
+{
+   return T::Create(is);
+}
+
+// Packet codes 1-31 are dispatched from a dense table. The remaining packet
+// codes are sparse, and are dispatched by a switch.
+static constexpr std::size_t kDenseTableSize_ = 32u;
+
+static constexpr std::array<CreatePacketFunction, kDenseTableSize_> //
+   createDense_ {nullptr,
+                 CreatePacket<TextAndSpecialSymbolPacket>,          // 1
+                 CreatePacket<TextAndSpecialSymbolPacket>,          // 2
+                 CreatePacket<MesocycloneSymbolPacket>,             // 3
+                 CreatePacket<WindBarbDataPacket>,                  // 4
+                 CreatePacket<VectorArrowDataPacket>,               // 5
+                 CreatePacket<LinkedVectorPacket>,                  // 6
+                 CreatePacket<UnlinkedVectorPacket>,                // 7
+                 CreatePacket<TextAndSpecialSymbolPacket>,          // 8
+                 CreatePacket<LinkedVectorPacket>,                  // 9
+                 CreatePacket<UnlinkedVectorPacket>,                // 10
+                 CreatePacket<MesocycloneSymbolPacket>,             // 11
+                 CreatePacket<PointGraphicSymbolPacket>,            // 12
+                 CreatePacket<PointGraphicSymbolPacket>,            // 13
+                 CreatePacket<PointGraphicSymbolPacket>,            // 14
+                 CreatePacket<StormIdSymbolPacket>,                 // 15
+                 CreatePacket<DigitalRadialDataArrayPacket>,        // 16
+                 CreatePacket<DigitalPrecipitationDataArrayPacket>, // 17
+                 CreatePacket<PrecipitationRateDataArrayPacket>,    // 18
+                 CreatePacket<HdaHailSymbolPacket>,                 // 19
+                 CreatePacket<PointFeatureSymbolPacket>,            // 20
+                 CreatePacket<CellTrendDataPacket>,                 // 21
+                 CreatePacket<CellTrendVolumeScanTimes>,            // 22
+                 CreatePacket<ScitForecastDataPacket>,              // 23
+                 CreatePacket<ScitForecastDataPacket>,              // 24
+                 CreatePacket<StiCircleSymbolPacket>,               // 25
+                 CreatePacket<PointGraphicSymbolPacket>,            // 26
+                 nullptr,                                           // 27
+                 CreatePacket<GenericDataPacket>,                   // 28
+                 CreatePacket<GenericDataPacket>,                   // 29
+                 nullptr,                                           // 30
+                 nullptr};                                          // 31
+
+static constexpr CreatePacketFunction GetCreateFunction(uint16_t packetCode)
+{
+   if (packetCode < kDenseTableSize_)
+   {
+      return createDense_[packetCode];
+   }
+
+   switch (packetCode)
+   {
+   case 0x0802:
+      return CreatePacket<SetColorLevelPacket>;
+   case 0x0E03:
+      return CreatePacket<LinkedContourVectorPacket>;
+   case 0x3501:
+      return CreatePacket<UnlinkedContourVectorPacket>;
+   case 0xAF1F:
+      return CreatePacket<RadialDataPacket>;
+   case 0xBA07:
+   case 0xBA0F:
+      return CreatePacket<RasterDataPacket>;
+   default:
+      return nullptr;
+   }
+}
 
 std::shared_ptr<Packet> PacketFactory::Create(std::istream& is)
 {
@@ -83,17 +117,32 @@ std::shared_ptr<Packet> PacketFactory::Create(std::istream& is)
 
    uint16_t packetCode;
 
-   is.read(reinterpret_cast<char*>(&packetCode), 2);
-   packetCode = ntohs(packetCode);
+   // Read the packet code from the arena in place if possible, otherwise
+   // read and rewind the stream
+   util::arenabuf* arena = dynamic_cast<util::arenabuf*>(is.rdbuf());
 
-   if (is.eof())
+   if (arena != nullptr && arena->in_avail() >= 2)
    {
-      packetValid = false;
+      std::memcpy(&packetCode, arena->current(), 2);
+   }
+   else
+   {
+      is.read(reinterpret_cast<char*>(&packetCode), 2);
+
+      if (is.eof())
+      {
+         packetValid = false;
+      }
+
+      is.seekg(-2, std::ios_base::cur);
    }
 
-   is.seekg(-2, std::ios_base::cur);
+   packetCode = ntohs(packetCode);
+
+   CreatePacketFunction create =
+      packetValid ? GetCreateFunction(packetCode) : nullptr;
 
-   if (packetValid && create_.find(packetCode) == create_.end())
+   if (packetValid && create == nullptr)
    {
       logger_->warn("Unknown packet code: {0} (0x{0:x})", packetCode);
       packetValid = false;
@@ -102,7 +151,7 @@ std::shared_ptr<Packet> PacketFactory::Create(std::istream& is)
    if (packetValid)
    {
       logger_->trace("Found packet code: {0} (0x{0:x})", packetCode);
-      packet = create_.at(packetCode)(is);
+      packet = create(is);
    }
 
    return packet;
@@ -602,6 +602,19 @@ bool ProductDescriptionBlock::IsCompressionEnabled() const
    return isCompressed;
 }
 
+uint32_t ProductDescriptionBlock::uncompressed_size() const
+{
+   uint32_t uncompressedSize = 0;
+
+   if (IsCompressionEnabled())
+   {
+      uncompressedSize = (static_cast<uint32_t>(p->parameters_[8]) << 16) |
+                         p->parameters_[9];
+   }
+
+   return uncompressedSize;
+}
+
 size_t ProductDescriptionBlock::data_size() const
 {
    return SIZE;
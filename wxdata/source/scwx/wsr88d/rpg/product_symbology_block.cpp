@@ -1,9 +1,13 @@
 #include <scwx/wsr88d/rpg/product_symbology_block.hpp>
+#include <scwx/wsr88d/rpg/digital_radial_data_array_packet.hpp>
 #include <scwx/wsr88d/rpg/packet_factory.hpp>
+#include <scwx/wsr88d/rpg/radial_data_packet.hpp>
+#include <scwx/wsr88d/rpg/raster_data_packet.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <istream>
 #include <string>
+#include <unordered_map>
 
 namespace scwx
 {
@@ -24,17 +28,32 @@ public:
        blockId_ {0},
        lengthOfBlock_ {0},
        numberOfLayers_ {0},
-       layerList_ {}
+       layerList_ {},
+       packetIndex_ {},
+       digitalRadialDataArrayPacket_ {nullptr},
+       radialDataPacket_ {nullptr},
+       rasterDataPacket_ {nullptr}
    {
    }
    ~ProductSymbologyBlockImpl() = default;
 
+   void IndexPacket(const std::shared_ptr<Packet>& packet);
+
    int16_t  blockDivider_;
    int16_t  blockId_;
    uint32_t lengthOfBlock_;
    uint16_t numberOfLayers_;
 
    std::vector<std::vector<std::shared_ptr<Packet>>> layerList_;
+
+   // Packets by packet code, and the first data packet of each type, built at
+   // parse time
+   std::unordered_map<uint16_t, std::vector<std::shared_ptr<Packet>>>
+      packetIndex_;
+
+   std::shared_ptr<DigitalRadialDataArrayPacket> digitalRadialDataArrayPacket_;
+   std::shared_ptr<RadialDataPacket>             radialDataPacket_;
+   std::shared_ptr<RasterDataPacket>             rasterDataPacket_;
 };
 
 ProductSymbologyBlock::ProductSymbologyBlock() :
@@ -58,12 +77,41 @@ uint16_t ProductSymbologyBlock::number_of_layers() const
    return p->numberOfLayers_;
 }
 
-std::vector<std::shared_ptr<Packet>>
+const std::vector<std::shared_ptr<Packet>>&
 ProductSymbologyBlock::packet_list(uint16_t i) const
 {
    return p->layerList_[i];
 }
 
+std::span<const std::shared_ptr<Packet>>
+ProductSymbologyBlock::packets(uint16_t packetCode) const
+{
+   auto it = p->packetIndex_.find(packetCode);
+   if (it != p->packetIndex_.cend())
+   {
+      return it->second;
+   }
+   return {};
+}
+
+std::shared_ptr<DigitalRadialDataArrayPacket>
+ProductSymbologyBlock::digital_radial_data_array_packet() const
+{
+   return p->digitalRadialDataArrayPacket_;
+}
+
+std::shared_ptr<RadialDataPacket>
+ProductSymbologyBlock::radial_data_packet() const
+{
+   return p->radialDataPacket_;
+}
+
+std::shared_ptr<RasterDataPacket>
+ProductSymbologyBlock::raster_data_packet() const
+{
+   return p->rasterDataPacket_;
+}
+
 size_t ProductSymbologyBlock::data_size() const
 {
    return p->lengthOfBlock_;
@@ -141,6 +189,7 @@ bool ProductSymbologyBlock::Parse(std::istream& is)
             std::shared_ptr<Packet> packet = PacketFactory::Create(is);
             if (packet != nullptr)
             {
+               p->IndexPacket(packet);
                packetList.push_back(packet);
                bytesRead += static_cast<uint32_t>(packet->data_size());
             }
@@ -180,6 +229,45 @@ bool ProductSymbologyBlock::Parse(std::istream& is)
    return blockValid;
 }
 
+void ProductSymbologyBlockImpl::IndexPacket(
+   const std::shared_ptr<Packet>& packet)
+{
+   const uint16_t packetCode = packet->packet_code();
+
+   packetIndex_[packetCode].push_back(packet);
+
+   // Packet codes are created by the packet factory as a single class, so the
+   // data packets do not need to be dynamically cast
+   switch (packetCode)
+   {
+   case 16:
+      if (digitalRadialDataArrayPacket_ == nullptr)
+      {
+         digitalRadialDataArrayPacket_ =
+            std::static_pointer_cast<DigitalRadialDataArrayPacket>(packet);
+      }
+      break;
+
+   case 0xAF1F:
+      if (radialDataPacket_ == nullptr)
+      {
+         radialDataPacket_ = std::static_pointer_cast<RadialDataPacket>(packet);
+      }
+      break;
+
+   case 0xBA07:
+   case 0xBA0F:
+      if (rasterDataPacket_ == nullptr)
+      {
+         rasterDataPacket_ = std::static_pointer_cast<RasterDataPacket>(packet);
+      }
+      break;
+
+   default:
+      break;
+   }
+}
+
 } // namespace rpg
 } // namespace wsr88d
 } // namespace scwx
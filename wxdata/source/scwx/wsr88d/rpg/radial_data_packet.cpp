@@ -1,5 +1,6 @@
 #include <scwx/wsr88d/rpg/radial_data_packet.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/run_length.hpp>
 
 #include <istream>
 #include <string>
@@ -19,18 +20,11 @@ class RadialDataPacketImpl
 public:
    struct Radial
    {
-      uint16_t             numberOfRleHalfwords_;
-      uint16_t             startAngle_;
-      uint16_t             angleDelta_;
-      std::vector<uint8_t> data_;
-      std::vector<uint8_t> level_;
-
-      Radial() :
-          numberOfRleHalfwords_ {0},
-          startAngle_ {0},
-          angleDelta_ {0},
-          data_ {},
-          level_ {}
+      uint16_t numberOfRleHalfwords_;
+      uint16_t startAngle_;
+      uint16_t angleDelta_;
+
+      Radial() : numberOfRleHalfwords_ {0}, startAngle_ {0}, angleDelta_ {0}
       {
       }
    };
@@ -43,6 +37,9 @@ public:
        jCenterOfSweep_ {0},
        scaleFactor_ {0},
        radial_ {},
+       startAngle_ {},
+       deltaAngle_ {},
+       level_ {},
        dataSize_ {0}
    {
    }
@@ -59,6 +56,13 @@ public:
    // Repeat for each radial
    std::vector<Radial> radial_;
 
+   // Start and delta angles of each radial in degrees, stored contiguously
+   std::vector<float> startAngle_;
+   std::vector<float> deltaAngle_;
+
+   // Levels decoded from each radial, stored as a radials × bins matrix
+   std::vector<uint8_t> level_;
+
    size_t dataSize_;
 };
 
@@ -109,17 +113,34 @@ uint16_t RadialDataPacket::number_of_radials() const
 
 float RadialDataPacket::start_angle(uint16_t r) const
 {
-   return p->radial_[r].startAngle_ * 0.1f;
+   return p->startAngle_[r];
 }
 
 float RadialDataPacket::delta_angle(uint16_t r) const
 {
-   return p->radial_[r].angleDelta_ * 0.1f;
+   return p->deltaAngle_[r];
+}
+
+std::span<const uint8_t> RadialDataPacket::level(uint16_t r) const
+{
+   return std::span<const uint8_t> {p->level_}.subspan(
+      static_cast<std::size_t>(r) * p->numberOfRangeBins_,
+      p->numberOfRangeBins_);
+}
+
+std::span<const float> RadialDataPacket::start_angles() const
+{
+   return p->startAngle_;
+}
+
+std::span<const float> RadialDataPacket::delta_angles() const
+{
+   return p->deltaAngle_;
 }
 
-const std::vector<uint8_t>& RadialDataPacket::level(uint16_t r) const
+std::span<const uint8_t> RadialDataPacket::levels() const
 {
-   return p->radial_[r].level_;
+   return p->level_;
 }
 
 size_t RadialDataPacket::data_size() const
@@ -177,6 +198,13 @@ bool RadialDataPacket::Parse(std::istream& is)
    if (blockValid)
    {
       p->radial_.resize(p->numberOfRadials_);
+      p->startAngle_.resize(p->numberOfRadials_);
+      p->deltaAngle_.resize(p->numberOfRadials_);
+      p->level_.resize(static_cast<std::size_t>(p->numberOfRadials_) *
+                       p->numberOfRangeBins_);
+
+      // RLE data is read into a buffer reused for each radial
+      std::vector<uint8_t> data {};
 
       for (uint16_t r = 0; r < p->numberOfRadials_; r++)
       {
@@ -191,6 +219,9 @@ bool RadialDataPacket::Parse(std::istream& is)
          radial.startAngle_           = ntohs(radial.startAngle_);
          radial.angleDelta_           = ntohs(radial.angleDelta_);
 
+         p->startAngle_[r] = radial.startAngle_ * 0.1f;
+         p->deltaAngle_[r] = radial.angleDelta_ * 0.1f;
+
          if (radial.numberOfRleHalfwords_ < 1 ||
              radial.numberOfRleHalfwords_ > 230)
          {
@@ -203,30 +234,17 @@ bool RadialDataPacket::Parse(std::istream& is)
 
          // Read RLE halfwords
          size_t dataSize = radial.numberOfRleHalfwords_ * 2;
-         radial.data_.resize(dataSize);
-         is.read(reinterpret_cast<char*>(radial.data_.data()), dataSize);
+         data.resize(dataSize);
+         is.read(reinterpret_cast<char*>(data.data()), dataSize);
          bytesRead += dataSize;
 
-         // If the final byte is 0, truncate it
-         if (radial.data_.back() == 0)
-         {
-            radial.data_.pop_back();
-         }
-
-         // Unpack the levels from the Run Length Encoded data
-         radial.level_.resize(p->numberOfRangeBins_);
-
-         uint16_t b = 0;
-         for (auto it = radial.data_.cbegin(); it != radial.data_.cend(); it++)
-         {
-            uint8_t run   = *it >> 4;
-            uint8_t level = *it & 0x0f;
-
-            for (int i = 0; i < run && b < p->numberOfRangeBins_; i++)
-            {
-               radial.level_[b++] = level;
-            }
-         }
+         // Unpack the levels from the Run Length Encoded data into the radial
+         // row of the level matrix. A final byte of 0 decodes to no bins.
+         util::DecodeRunLength(
+            data,
+            std::span<uint8_t> {p->level_}.subspan(
+               static_cast<std::size_t>(r) * p->numberOfRangeBins_,
+               p->numberOfRangeBins_));
       }
    }
 
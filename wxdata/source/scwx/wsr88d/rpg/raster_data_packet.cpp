@@ -1,6 +1,8 @@
 #include <scwx/wsr88d/rpg/raster_data_packet.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/run_length.hpp>
 
+#include <algorithm>
 #include <istream>
 #include <string>
 
@@ -19,11 +21,10 @@ class RasterDataPacketImpl
 public:
    struct Row
    {
-      uint16_t             numberOfBytes_;
-      std::vector<uint8_t> data_;
-      std::vector<uint8_t> level_;
+      uint16_t numberOfBytes_;
+      uint16_t numberOfBins_;
 
-      Row() : numberOfBytes_ {0}, data_ {}, level_ {} {}
+      Row() : numberOfBytes_ {0}, numberOfBins_ {0} {}
    };
 
    explicit RasterDataPacketImpl() :
@@ -38,6 +39,8 @@ public:
        numberOfRows_ {0},
        packagingDescriptor_ {0},
        row_ {},
+       numberOfColumns_ {0},
+       level_ {},
        dataSize_ {0}
    {
    }
@@ -57,6 +60,10 @@ public:
    // Repeat for each row
    std::vector<Row> row_;
 
+   // Levels decoded from each row, stored as a rows × columns matrix
+   uint16_t             numberOfColumns_;
+   std::vector<uint8_t> level_;
+
    size_t dataSize_;
 };
 
@@ -120,9 +127,16 @@ uint16_t RasterDataPacket::packaging_descriptor() const
    return p->packagingDescriptor_;
 }
 
-const std::vector<uint8_t>& RasterDataPacket::level(uint16_t r) const
+uint16_t RasterDataPacket::number_of_columns() const
+{
+   return p->numberOfColumns_;
+}
+
+std::span<const uint8_t> RasterDataPacket::level(uint16_t r) const
 {
-   return p->row_[r].level_;
+   return std::span<const uint8_t> {p->level_}.subspan(
+      static_cast<std::size_t>(r) * p->numberOfColumns_,
+      p->row_[r].numberOfBins_);
 }
 
 size_t RasterDataPacket::data_size() const
@@ -178,6 +192,10 @@ bool RasterDataPacket::Parse(std::istream& is)
       }
    }
 
+   // RLE data of all rows is read before decoding, in order to size the level
+   // matrix
+   std::vector<uint8_t> data {};
+
    if (blockValid)
    {
       p->row_.resize(p->numberOfRows_);
@@ -202,38 +220,40 @@ bool RasterDataPacket::Parse(std::istream& is)
          }
 
          // Read row data
-         size_t dataSize = row.numberOfBytes_;
-         row.data_.resize(dataSize);
-         is.read(reinterpret_cast<char*>(row.data_.data()), dataSize);
+         size_t dataSize   = row.numberOfBytes_;
+         size_t dataOffset = data.size();
+         data.resize(dataOffset + dataSize);
+         is.read(reinterpret_cast<char*>(data.data() + dataOffset), dataSize);
          bytesRead += dataSize;
 
-         // If the final byte is 0, truncate it
-         if (row.data_.back() == 0)
-         {
-            row.data_.pop_back();
-         }
+         // Count the bins in the row. A final byte of 0 contains no bins.
+         row.numberOfBins_ = static_cast<uint16_t>(util::CountRunLength(
+            std::span<const uint8_t> {data}.subspan(dataOffset)));
+
+         p->numberOfColumns_ =
+            std::max(p->numberOfColumns_, row.numberOfBins_);
+      }
+   }
 
-         // Unpack the levels from the Run Length Encoded data
-         uint16_t binCount =
-            std::accumulate(row.data_.cbegin(),
-                            row.data_.cend(),
-                            static_cast<uint16_t>(0u),
-                            [](const uint16_t& a, const uint8_t& b) -> uint16_t
-                            { return a + (b >> 4); });
+   if (blockValid)
+   {
+      p->level_.resize(static_cast<std::size_t>(p->numberOfRows_) *
+                       p->numberOfColumns_);
 
-         row.level_.resize(binCount);
+      // Unpack the levels from the Run Length Encoded data
+      std::size_t dataOffset = 0;
+      for (uint16_t r = 0; r < p->numberOfRows_; r++)
+      {
+         const auto& row = p->row_[r];
 
-         uint16_t b = 0;
-         for (auto it = row.data_.cbegin(); it != row.data_.cend(); it++)
-         {
-            uint8_t run   = *it >> 4;
-            uint8_t level = *it & 0x0f;
+         util::DecodeRunLength(
+            std::span<const uint8_t> {data}.subspan(dataOffset,
+                                                    row.numberOfBytes_),
+            std::span<uint8_t> {p->level_}.subspan(
+               static_cast<std::size_t>(r) * p->numberOfColumns_,
+               row.numberOfBins_));
 
-            for (int i = 0; i < run && b < binCount; i++)
-            {
-               row.level_[b++] = level;
-            }
-         }
+         dataOffset += row.numberOfBytes_;
       }
    }
 
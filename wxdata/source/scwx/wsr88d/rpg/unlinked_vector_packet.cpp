@@ -73,6 +73,31 @@ std::optional<uint16_t> UnlinkedVectorPacket::value_of_vector() const
    return value;
 }
 
+int16_t UnlinkedVectorPacket::begin_i(size_t v) const
+{
+   return p->beginI_[v];
+}
+
+int16_t UnlinkedVectorPacket::begin_j(size_t v) const
+{
+   return p->beginJ_[v];
+}
+
+int16_t UnlinkedVectorPacket::end_i(size_t v) const
+{
+   return p->endI_[v];
+}
+
+int16_t UnlinkedVectorPacket::end_j(size_t v) const
+{
+   return p->endJ_[v];
+}
+
+size_t UnlinkedVectorPacket::vector_count() const
+{
+   return p->endI_.size();
+}
+
 size_t UnlinkedVectorPacket::data_size() const
 {
    return p->lengthOfBlock_ + 4u;
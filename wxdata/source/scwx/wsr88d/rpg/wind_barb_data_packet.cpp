@@ -68,6 +68,36 @@ uint16_t WindBarbDataPacket::length_of_block() const
    return p->lengthOfBlock_;
 }
 
+uint16_t WindBarbDataPacket::value(size_t i) const
+{
+   return p->windBarb_[i].value_;
+}
+
+int16_t WindBarbDataPacket::x_coordinate(size_t i) const
+{
+   return p->windBarb_[i].xCoordinate_;
+}
+
+int16_t WindBarbDataPacket::y_coordinate(size_t i) const
+{
+   return p->windBarb_[i].yCoordinate_;
+}
+
+uint16_t WindBarbDataPacket::direction_of_wind(size_t i) const
+{
+   return p->windBarb_[i].directionOfWind_;
+}
+
+uint16_t WindBarbDataPacket::wind_speed(size_t i) const
+{
+   return p->windBarb_[i].windSpeed_;
+}
+
+size_t WindBarbDataPacket::RecordCount() const
+{
+   return p->windBarb_.size();
+}
+
 size_t WindBarbDataPacket::data_size() const
 {
    return p->lengthOfBlock_ + 4u;
@@ -3,9 +3,11 @@ cmake_minimum_required(VERSION 3.20)
 project(scwx-data)
 
 find_package(Boost)
+find_package(BZip2)
 find_package(cpr)
 find_package(LibXml2)
 find_package(spdlog)
+find_package(ZLIB)
 
 if (NOT MSVC)
     find_package(TBB)
@@ -59,23 +61,31 @@ set(SRC_PROVIDER source/scwx/provider/aws_level2_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider_factory.cpp
                  source/scwx/provider/warnings_provider.cpp)
-set(HDR_UTIL include/scwx/util/environment.hpp
+set(HDR_UTIL include/scwx/util/arenabuf.hpp
+             include/scwx/util/binary.hpp
+             include/scwx/util/compression.hpp
+             include/scwx/util/environment.hpp
              include/scwx/util/float.hpp
              include/scwx/util/hash.hpp
              include/scwx/util/iterator.hpp
              include/scwx/util/logger.hpp
              include/scwx/util/map.hpp
              include/scwx/util/rangebuf.hpp
+             include/scwx/util/run_length.hpp
              include/scwx/util/streams.hpp
              include/scwx/util/strings.hpp
              include/scwx/util/threads.hpp
              include/scwx/util/time.hpp
              include/scwx/util/vectorbuf.hpp)
-set(SRC_UTIL source/scwx/util/environment.cpp
+set(SRC_UTIL source/scwx/util/arenabuf.cpp
+             source/scwx/util/binary.cpp
+             source/scwx/util/compression.cpp
+             source/scwx/util/environment.cpp
              source/scwx/util/float.cpp
              source/scwx/util/hash.cpp
              source/scwx/util/logger.cpp
              source/scwx/util/rangebuf.cpp
+             source/scwx/util/run_length.cpp
              source/scwx/util/streams.cpp
              source/scwx/util/strings.cpp
              source/scwx/util/time.cpp
@@ -91,10 +101,12 @@ set(SRC_WSR88D source/scwx/wsr88d/ar2v_file.cpp
                source/scwx/wsr88d/nexrad_file_factory.cpp)
 set(HDR_WSR88D_RDA include/scwx/wsr88d/rda/clutter_filter_bypass_map.hpp
                    include/scwx/wsr88d/rda/clutter_filter_map.hpp
+                   include/scwx/wsr88d/rda/deferred_level2_message.hpp
                    include/scwx/wsr88d/rda/digital_radar_data.hpp
                    include/scwx/wsr88d/rda/level2_message.hpp
                    include/scwx/wsr88d/rda/level2_message_factory.hpp
                    include/scwx/wsr88d/rda/level2_message_header.hpp
+                   include/scwx/wsr88d/rda/packed_elevation_scan.hpp
                    include/scwx/wsr88d/rda/performance_maintenance_data.hpp
                    include/scwx/wsr88d/rda/rda_adaptation_data.hpp
                    include/scwx/wsr88d/rda/rda_status_data.hpp
@@ -102,10 +114,12 @@ set(HDR_WSR88D_RDA include/scwx/wsr88d/rda/clutter_filter_bypass_map.hpp
                    include/scwx/wsr88d/rda/volume_coverage_pattern_data.hpp)
 set(SRC_WSR88D_RDA source/scwx/wsr88d/rda/clutter_filter_bypass_map.cpp
                    source/scwx/wsr88d/rda/clutter_filter_map.cpp
+                   source/scwx/wsr88d/rda/deferred_level2_message.cpp
                    source/scwx/wsr88d/rda/digital_radar_data.cpp
                    source/scwx/wsr88d/rda/level2_message.cpp
                    source/scwx/wsr88d/rda/level2_message_factory.cpp
                    source/scwx/wsr88d/rda/level2_message_header.cpp
+                   source/scwx/wsr88d/rda/packed_elevation_scan.cpp
                    source/scwx/wsr88d/rda/performance_maintenance_data.cpp
                    source/scwx/wsr88d/rda/rda_adaptation_data.cpp
                    source/scwx/wsr88d/rda/rda_status_data.cpp
@@ -227,6 +241,8 @@ source_group("Header Files\\wsr88d\\rpg" FILES ${HDR_WSR88D_RPG})
 source_group("Source Files\\wsr88d\\rpg" FILES ${SRC_WSR88D_RPG})
 
 target_include_directories(wxdata PRIVATE ${Boost_INCLUDE_DIR}
+                                          ${BZip2_INCLUDE_DIRS}
+                                          ${ZLIB_INCLUDE_DIRS}
                                           ${HSLUV_C_INCLUDE_DIR}
                                           ${scwx-data_SOURCE_DIR}/include
                                           ${scwx-data_SOURCE_DIR}/source)
@@ -251,7 +267,8 @@ target_link_libraries(wxdata PUBLIC aws-cpp-sdk-core
                                     spdlog::spdlog)
 target_link_libraries(wxdata INTERFACE Boost::iostreams
                                        BZip2::BZip2
-                                       hsluv-c)
+                                       hsluv-c
+                                       ZLIB::ZLIB)
 
 if (WIN32)
     target_link_libraries(wxdata INTERFACE Ws2_32)